@@ -2,9 +2,9 @@
 
 #include <smk/Input.hpp>
 #include <smk/Sprite.hpp>
-#include <smk/Text.hpp>
 #include "game/Resource.hpp"
 #include "game/Lang.hpp"
+#include "game/TextCache.hpp"
 #include <glm/gtx/compatibility.hpp>
 #include <smk/Color.hpp>
 #include "game/BackgroundMusic.hpp"
@@ -17,6 +17,26 @@ void IntroScreen::OnEnter() {
   dx = 0;
   position = 1;
   background_music.SetSound(SB_intro);
+
+  auto page = [](std::initializer_list<TextId> lines) {
+    std::wstring text;
+    for (auto line = lines.begin(); line != lines.end(); ++line) {
+      if (line != lines.begin())
+        text += L"\n";
+      text += tr(*line);
+    }
+    return text;
+  };
+
+  // clang-format off
+  text_ = {
+    page({TextId::intro11, TextId::intro12, TextId::intro13, TextId::intro14}),
+    page({TextId::intro21, TextId::intro22, TextId::intro23, TextId::intro24}),
+    page({TextId::intro31, TextId::intro32, TextId::intro33, TextId::intro34}),
+    page({TextId::intro41, TextId::intro42, TextId::intro43, TextId::intro44, TextId::intro45}),
+    page({TextId::intro51, TextId::intro52, TextId::intro53, TextId::intro54}),
+  };
+  // clang-format on
 }
 
 void IntroScreen::Draw() {
@@ -61,22 +81,12 @@ void IntroScreen::Draw() {
 
   // Text
   {
-    // clang-format off
-    smk::Text text[] = {
-      smk::Text(font_arial, tr(L"intro11") + L"\n" + tr(L"intro12") + L"\n" + tr(L"intro13") + L"\n" + tr(L"intro14")),
-      smk::Text(font_arial, tr(L"intro21") + L"\n" + tr(L"intro22") + L"\n" + tr(L"intro23") + L"\n" + tr(L"intro24")),
-      smk::Text(font_arial, tr(L"intro31") + L"\n" + tr(L"intro32") + L"\n" + tr(L"intro33") + L"\n" + tr(L"intro34")),
-      smk::Text(font_arial, tr(L"intro41") + L"\n" + tr(L"intro42") + L"\n" + tr(L"intro43") + L"\n" + tr(L"intro44") + L"\n" + tr(L"intro45")),
-      smk::Text(font_arial, tr(L"intro51") + L"\n" + tr(L"intro52") + L"\n" + tr(L"intro53") + L"\n" + tr(L"intro54")),
-    };
-    // clang-format on
-
     int p = 0;
-    for(auto& it : text) {
+    for(auto& it : text_) {
       if (p >= position)
         break;
-      it.SetPosition(670 - x + p * 640, 10);
-      window().Draw(it);
+      text_cache.Draw(window(), font_arial, it, {670 - x + p * 640, 10},
+                      smk::Color::White);
       ++p;
     }
   }
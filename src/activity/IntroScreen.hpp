@@ -3,6 +3,8 @@
 
 #include "activity/Activity.hpp"
 #include <memory>
+#include <string>
+#include <vector>
 
 class IntroScreen : public Activity {
  public:
@@ -27,6 +29,8 @@ class IntroScreen : public Activity {
   float Rxpos = 0;
 
   int timeDelay = 10;
+
+  std::vector<std::wstring> text_;
 };
 
 #endif /* end of include guard: INTRO_SCREEN_HPP */
@@ -1,15 +1,100 @@
 #include "activity/LevelScreen.hpp"
 #include <smk/Color.hpp>
 #include <smk/Vibrate.hpp>
+#include "game/AudioThread.hpp"
+#include "game/BackgroundMusic.hpp"
+#include "game/Resource.hpp"
 
-LevelScreen::LevelScreen(smk::Window& window, std::string level_name)
-    : Activity(window) {
-  level_.LoadFromFile(level_name);
+extern AudioThread audio_thread;
+extern BackgroundMusic background_music;
+
+namespace {
+
+// The best run of a level, next to the saves.
+std::string GhostPath(const std::string& level_name) {
+  return SavePath() + "/InTheCubeGhost_" +
+         level_name.substr(level_name.find_last_of("/\\") + 1);
+}
+
+}  // namespace
+
+LevelScreen::LevelScreen(smk::Window& window,
+                         std::string level_name,
+                         Level level,
+                         FileWriter& file_writer,
+                         Telemetry* telemetry)
+    : Activity(window),
+      level_(std::move(level)),
+      level_name_(level_name),
+      level_file_(level_name),
+      file_writer_(file_writer),
+      best_ghost_(GhostPath(level_name)) {
+  level_.telemetry = telemetry;
+  level_.audio = &audio_thread.level();
+  level_.Record(TelemetryEvent{0, 0, 0.f, 0.f, TelemetryType::Start});
+  if (best_ghost_.valid())
+    level_.ghosts.push_back(&best_ghost_);
+  background_music.SetSound(level_.music());
   frame = 0;
   start_time = window.time();
 }
 
+namespace {
+
+#if defined(__EMSCRIPTEN__)
+// Without threads, the steps run when the next frame waits for them.
+const std::launch kStepLaunch = std::launch::deferred;
+#else
+const std::launch kStepLaunch = std::launch::async;
+#endif
+
+}  // namespace
+
 void LevelScreen::Draw() {
+  // The steps started by the previous frame ran while it was displayed.
+  if (steps_.valid())
+    steps_.get();
+
+  if (level_file_.Changed())
+    level_.Reload(level_name_);
+
+  draw_list_.Clear();
+  level_.Draw(draw_list_);
+
+  std::function<void()> next;
+  // clang-format off
+  if (level_.isLose)          next = on_restart;
+  else if (level_.isWin)      next = on_win;
+  else if (level_.isPrevious) next = on_previous;
+  else if (level_.isEscape)   next = on_quit;
+  // clang-format on
+
+  // A new best run becomes the ghost of the level. Written in the
+  // background: this frame doesn't wait for the disk.
+  if (level_.isWin && (!best_ghost_.valid() ||
+                       ghost_recorder_.ticks() < best_ghost_.ticks())) {
+    file_writer_.Write(GhostPath(level_name_), ghost_recorder_.Encode());
+  }
+
+  // The level is drawn from the list, so it can already move on to the next
+  // frame in the meantime.
+  if (!next) {
+    steps_ = std::async(kStepLaunch, [this, inputs = ReadInputs()] {
+      for (Input::T input : inputs) {
+        level_.Step(input);
+        ghost_recorder_.Record(level_.ticks(), level_.ghost_sample());
+      }
+    });
+  }
+
+  draw_list_.Execute(window());
+
+  if (next)
+    next();
+}
+
+std::vector<Input::T> LevelScreen::ReadInputs() {
+  std::vector<Input::T> inputs;
   float new_time = window().time();
   int new_frame = (new_time - start_time) * 30;
 
@@ -36,6 +121,11 @@ void LevelScreen::Draw() {
       game_input |= Input::Restart;
     if (input.IsKeyReleased(GLFW_KEY_ESCAPE))
       game_input |= Input::Escape;
+    if (input.IsMousePressed(GLFW_MOUSE_BUTTON_1) ||
+        input.IsKeyPressed(GLFW_KEY_SPACE) ||
+        input.IsKeyPressed(GLFW_KEY_ENTER) || input.IsCursorReleased()) {
+      game_input |= Input::Next;
+    }
 
     if (input.IsCursorPressed()) {
       cursor_in = true;
@@ -61,15 +151,7 @@ void LevelScreen::Draw() {
       smk::Vibrate(10);
     previous_input = game_input;
 
-    level_.Step(Input::T(game_input), window());
+    inputs.push_back(Input::T(game_input));
   }
-
-  level_.Draw(window());
-
-  // clang-format off
-  if (level_.isLose)     return on_restart();
-  if (level_.isWin)      return on_win();
-  if (level_.isPrevious) return on_previous();
-  if (level_.isEscape)   return on_quit();
-  // clang-format on
+  return inputs;
 }
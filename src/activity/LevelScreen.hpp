@@ -2,13 +2,26 @@
 #define LEVEL_WINDOW_HPP
 
 #include "activity/Activity.hpp"
+#include "game/DrawList.hpp"
+#include "game/FileWatcher.hpp"
+#include "game/FileWriter.hpp"
+#include "game/Ghost.hpp"
 #include "game/Level.hpp"
 #include "game/SaveManager.hpp"
+#include <future>
 #include <memory>
+#include <vector>
 
 class LevelScreen : public Activity {
  public:
-  LevelScreen(smk::Window& window, std::string level);
+  // Play |level|, loaded from the file |level_name|. A new best run is saved
+  // by |file_writer|. The events of the game are sent to |telemetry|, when
+  // not null.
+  LevelScreen(smk::Window& window,
+              std::string level_name,
+              Level level,
+              FileWriter& file_writer,
+              Telemetry* telemetry = nullptr);
   ~LevelScreen() override = default;
 
   void Draw() override;
@@ -18,13 +31,28 @@ class LevelScreen : public Activity {
   std::function<void()> on_win = []{};
   std::function<void()> on_quit = []{};
  private:
+  // One entry per step to run, read since the last frame.
+  std::vector<Input::T> ReadInputs();
+
   Level level_;
+  std::string level_name_;
+  FileWatcher level_file_;  // Edited while playing.
+  FileWriter& file_writer_;
+  GhostReader best_ghost_;
+  GhostRecorder ghost_recorder_;
+  DrawList draw_list_;
   float start_time = 0.f;
   int frame = 0;
 
   bool cursor_in = false;
   glm::vec2 cursor_reference;
   int previous_input = 0;
+
+  // Steps running while the previous frame is displayed, on a thread without
+  // GL context. Their inputs are read before that frame is shown, so an
+  // input shows up one frame later than when stepping before drawing.
+  // Declared last, so they are awaited before the level is destroyed.
+  std::future<void> steps_;
 };
 
 #endif /* end of include guard: LEVEL_window_HPP */
@@ -7,14 +7,19 @@
 #include "activity/MainScreen.hpp"
 #include "activity/ResourceLoadingScreen.hpp"
 #include "activity/WelcomeScreen.hpp"
+#include "game/AudioThread.hpp"
 #include "game/BackgroundMusic.hpp"
+#include "game/FileWriter.hpp"
 #include "game/Lang.hpp"
 #include "game/Level.hpp"
 #include "game/LevelListLoader.hpp"
+#include "game/LevelPreloader.hpp"
 #include "game/Resource.hpp"
 #include "game/SaveManager.hpp"
+#include "game/Telemetry.hpp"
 
-BackgroundMusic background_music;
+AudioThread audio_thread;
+BackgroundMusic background_music(audio_thread.music());
 
 class Main {
  public:
@@ -22,7 +27,10 @@ class Main {
       : resource_loading_screen_(window_),
         welcome_screen_(window_),
         main_screen_(window_, savFile),
-        intro_screen_(window_) {
+        intro_screen_(window_),
+        telemetry_(SavePath() + "/InTheCubeTelemetry"),
+        savFile(file_writer_),
+        langFile(file_writer_) {
     window_ = smk::Window(640, 480, "InTheCube");
     Display(&resource_loading_screen_);
 
@@ -73,7 +81,8 @@ class Main {
       return;
     }
 
-    if (index >= (int)LevelListLoader().size()) {
+    std::vector<std::string> levels = LevelListLoader();
+    if (index >= (int)levels.size()) {
       Display(&welcome_screen_);
       return;
     }
@@ -82,8 +91,12 @@ class Main {
     savFile.Sync();
 
     to_be_removed_screen_ = std::move(level_screen_);
-    level_screen_ =
-        std::make_unique<LevelScreen>(window_, LevelListLoader()[level_index_]);
+    level_screen_ = std::make_unique<LevelScreen>(
+        window_, levels[index], level_preloader_.Take(levels[index]),
+        file_writer_, &telemetry_);
+    // Most likely played next.
+    if (index + 1 < (int)levels.size())
+      level_preloader_.Preload(levels[index + 1]);
     level_screen_->on_restart = [&] { MoveToLevel(level_index_); };
     level_screen_->on_win = [&] { MoveToLevel(level_index_ + 1); };
     level_screen_->on_previous = [&] { MoveToLevel(level_index_ - 1); };
@@ -108,7 +121,7 @@ class Main {
     }
 
     activity_->Draw();
-    background_music.Step();
+    audio_thread.Step();
     to_be_removed_screen_.reset();
 
 #ifndef __EMSCRIPTEN__
@@ -143,6 +156,11 @@ class Main {
   WelcomeScreen welcome_screen_;
   MainScreen main_screen_;
   IntroScreen intro_screen_;
+  // Outlives the level screens, which send it events.
+  Telemetry telemetry_;
+  // Outlives the level screens and the saves, which write files with it.
+  FileWriter file_writer_;
+  LevelPreloader level_preloader_;
   std::unique_ptr<LevelScreen> level_screen_;
   std::unique_ptr<LevelScreen> to_be_removed_screen_;
 
@@ -7,10 +7,10 @@
 #include <smk/Input.hpp>
 #include <smk/Shape.hpp>
 #include <smk/Sprite.hpp>
-#include <smk/Text.hpp>
 #include <smk/View.hpp>
 #include "game/Resource.hpp"
 #include "game/Lang.hpp"
+#include "game/TextCache.hpp"
 
 std::wstring to_wstring(const std::string& s) {
   std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
@@ -63,15 +63,7 @@ void MainScreen::Draw() {
   bool mouse_pressed = window().input().IsMousePressed(GLFW_MOUSE_BUTTON_1);
 
   // Draw the background.
-  {
-    auto background = smk::Sprite(img_background);
-    for (int x = 0; x <= 640; x += 24) {
-      for (int y = 0; y <= 480; y += 24) {
-        background.SetPosition(x, y);
-        window().Draw(background);
-      }
-    }
-  }
+  background_.Draw(window(), {0.f, 0.f}, {640 + 24, 480 + 24});
 
   // Language
   for (int i = 0; i < 3; i++) {
@@ -112,17 +104,13 @@ void MainScreen::Draw() {
 
     // text
     {
-      smk::Text text;
-      text.SetFont(font_arial);
-      text.SetString(it.first + "  /  " + intToString(it.second));
-      text.SetPosition(40, 30 + i * 40);
-      text.SetColor(glm::vec4(0.0, 0.0, 0.0, 1.0));
-      text.Move(decale, 0);
-      window().Draw(text);
-
-      text.Move(-2, -2);
-      text.SetColor(glm::vec4(1.0, 1.0, 1.0, 1.0));
-      window().Draw(text);
+      std::wstring text =
+          to_wstring(it.first + "  /  " + intToString(it.second));
+      glm::vec2 position(40 + decale, 30 + i * 40);
+      text_cache.Draw(window(), font_arial, text, position,
+                      glm::vec4(0.0, 0.0, 0.0, 1.0));
+      text_cache.Draw(window(), font_arial, text, position - 2.f,
+                      glm::vec4(1.0, 1.0, 1.0, 1.0));
     }
 
     // deleteButton
@@ -146,11 +134,14 @@ void MainScreen::Draw() {
           if (mouse.x >= 0 && mouse.x <= 24 && mouse.y >= 30 + i * 40 &&
               mouse.y <= 24 + 30 + i * 40) {
             question_ = std::make_unique<Question>(window());
-            question_->question = tr(L"confirmDelete1") + L"\n" +
-                                  tr(L"confirmDelete2") + L"\n" +
-                                  tr(L"confirmDelete3") + to_wstring(it.first);
-            question_->yes = tr(L"yes");
-            question_->no = tr(L"no");
+            question_->question = std::wstring(tr(TextId::confirmDelete1)) +
+                                  L"\n" +
+                                  std::wstring(tr(TextId::confirmDelete2)) +
+                                  L"\n" +
+                                  std::wstring(tr(TextId::confirmDelete3)) +
+                                  to_wstring(it.first);
+            question_->yes = tr(TextId::yes);
+            question_->no = tr(TextId::no);
             question_->on_yes = [this, name = it.first] {
               save_file_.saveList.erase(name);
             };
@@ -164,9 +155,10 @@ void MainScreen::Draw() {
   auto newGame = smk::Sprite(img_newGame);
   newGame.SetPosition(320 - 300 / 2, 480 - 64);
 
-  auto newGameText = smk::Text(font_arial, tr(L"newGame"));
-  newGameText.SetPosition(220, 430);
-  newGameText.SetColor(glm::vec4(0.0, 0.0, 0.0, 1.0));
+  auto draw_new_game_text = [&] {
+    text_cache.Draw(window(), font_arial, tr(TextId::newGame), {220, 430},
+                    glm::vec4(0.0, 0.0, 0.0, 1.0));
+  };
 
   // button new game
   if (mouse.y < 480 && mouse.y > 480 - 64 && mouse.x > 640 / 2 - 300 / 2 &&
@@ -174,16 +166,16 @@ void MainScreen::Draw() {
     newGame.SetColor(glm::vec4(1.0, 1.0, 1.0, 1.0));
     if (mouse_pressed) {
       window().Draw(newGame);
-      window().Draw(newGameText);
+      draw_new_game_text();
 
       get_string_ = std::make_unique<GetString>(window());
-      get_string_->message = tr(L"enterYourName");
+      get_string_->message = tr(TextId::enterYourName);
       get_string_->on_enter = [this](std::string name) {
         if (save_file_.saveList.count(name)) {
           question_ = std::make_unique<Question>(window());
-          question_->question = tr(L"profileExistAlready");
-          question_->yes = tr(L"okay");
-          question_->no = tr(L"");
+          question_->question = tr(TextId::profileExistAlready);
+          question_->yes = tr(TextId::okay);
+          question_->no = L"";
         } else
           save_file_.saveList[name] = 0;
       };
@@ -192,7 +184,7 @@ void MainScreen::Draw() {
     newGame.SetColor(glm::vec4(200, 200, 200, 255) / 255.f);
   }
   window().Draw(newGame);
-  window().Draw(newGameText);
+  draw_new_game_text();
 
   if (question_) {
     if (question_->Draw(window()))
@@ -256,26 +248,20 @@ bool MainScreen::GetString::Draw(smk::Window& window) {
 
   // text
   if (typed_text_.empty()) {
-    smk::Text enter_your_name;
-    enter_your_name.SetFont(font_arial);
-    enter_your_name.SetString(tr(L"enterYourName"));
-    enter_your_name.SetColor(glm::vec4(0.3, 0.3, 0.3, alpha));
-
-    glm::vec2 dimension = enter_your_name.ComputeDimensions();
-    enter_your_name.SetPosition(640 / 2 - dimension.x / 2,
-                                480 / 2 - dimension.y / 2);
-    window.Draw(enter_your_name);
+    std::wstring_view enter_your_name = tr(TextId::enterYourName);
+    glm::vec2 dimension = text_cache.Dimensions(font_arial, enter_your_name);
+    text_cache.Draw(window, font_arial, enter_your_name,
+                    {640 / 2 - dimension.x / 2, 480 / 2 - dimension.y / 2},
+                    glm::vec4(0.3, 0.3, 0.3, alpha));
   }
 
   // Written text
   {
-    smk::Text text;
-    text.SetFont(font_arial);
-    text.SetString(typed_text_);
-    auto dimension = text.ComputeDimensions();
-    text.SetPosition(640 / 2 - dimension.x / 2, 480 / 2 - dimension.y / 2);
-    text.SetColor(glm::vec4(0.0, 0.0, 0.0, alpha));
-    window.Draw(text);
+    std::wstring text = to_wstring(typed_text_);
+    auto dimension = text_cache.Dimensions(font_arial, text);
+    text_cache.Draw(window, font_arial, text,
+                    {640 / 2 - dimension.x / 2, 480 / 2 - dimension.y / 2},
+                    glm::vec4(0.0, 0.0, 0.0, alpha));
 
     if (window.input().IsKeyPressed(GLFW_KEY_BACKSPACE) ||
         dimension.x > img_cadreInput.width() - 12) {
@@ -327,26 +313,20 @@ bool MainScreen::Question::Draw(smk::Window& window) {
 
   // Question
   {
-    smk::Text text_string;
-    text_string.SetFont(font_arial);
-    text_string.SetString(question);
-    auto dimension = text_string.ComputeDimensions();
-    text_string.SetPosition(640 * 0.5 - dimension.x / 2, 480 * 0.2 + 10);
-    text_string.SetColor(glm::vec4(0.f, 0.f, 0.f, alpha));
-    window.Draw(text_string);
+    auto dimension = text_cache.Dimensions(font_arial, question);
+    text_cache.Draw(window, font_arial, question,
+                    {640 * 0.5 - dimension.x / 2, 480 * 0.2 + 10},
+                    glm::vec4(0.f, 0.f, 0.f, alpha));
   }
 
   // Yes answer
   {
-    smk::Text yes_string;
-    yes_string.SetFont(font_arial);
-    yes_string.SetString(yes);
-    auto dimension = yes_string.ComputeDimensions();
+    auto dimension = text_cache.Dimensions(font_arial, yes);
     float left = 640 * 0.2 + 10;
     float right = left + dimension.x;
     float bottom = 480 * 0.8 - 10;
     float top = bottom - dimension.y;
-    yes_string.SetPosition(left, top);
+    glm::vec4 color(0.5, 0.5, 0.5, alpha);
 
     auto mouse = window.input().mouse();
     bool hover = mouse.x >= left &&   //
@@ -354,43 +334,36 @@ bool MainScreen::Question::Draw(smk::Window& window) {
                  mouse.y >= top &&    //
                  mouse.y <= bottom;
     if (hover) {
-      yes_string.SetColor(glm::vec4(0.f, 0.f, 0.f, alpha));
+      color = glm::vec4(0.f, 0.f, 0.f, alpha);
       if (window.input().IsMousePressed(GLFW_MOUSE_BUTTON_1) && !exiting_) {
         on_yes();
         exiting_ = true;
       }
-    } else {
-      yes_string.SetColor(glm::vec4(0.5, 0.5, 0.5, alpha));
     }
 
-    window.Draw(yes_string);
+    text_cache.Draw(window, font_arial, yes, {left, top}, color);
   }
 
   // No answer
   {
-    smk::Text no_string;
-    no_string.SetFont(font_arial);
-    no_string.SetString(no);
-    auto dimension = no_string.ComputeDimensions();
+    auto dimension = text_cache.Dimensions(font_arial, no);
     float right = 640 * 0.8 - 10;
     float left = right - dimension.x;
     float bottom = 480 * 0.8 - 10;
     float top = bottom - dimension.y;
-    no_string.SetPosition(left, top);
+    glm::vec4 color(0.5, 0.5, 0.5, alpha);
 
     if (window.input().mouse().x >= left &&   //
         window.input().mouse().x <= right &&  //
         window.input().mouse().y >= top &&    //
         window.input().mouse().y <= bottom) {
-      no_string.SetColor(glm::vec4(0.0, 0.0, 0.0, alpha));
+      color = glm::vec4(0.0, 0.0, 0.0, alpha);
       if (window.input().IsMousePressed(GLFW_MOUSE_BUTTON_1) && !exiting_) {
         on_no();
         exiting_ = true;
       }
-    } else {
-      no_string.SetColor(glm::vec4(0.5, 0.5, 0.5, alpha));
     }
-    window.Draw(no_string);
+    text_cache.Draw(window, font_arial, no, {left, top}, color);
   }
 
   return false;
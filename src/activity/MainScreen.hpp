@@ -2,7 +2,9 @@
 #define MAINwindow_HPP
 
 #include "activity/Activity.hpp"
+#include "game/Resource.hpp"
 #include "game/SaveManager.hpp"
+#include "game/TiledBackground.hpp"
 #include <functional>
 #include <memory>
 
@@ -22,6 +24,7 @@ class MainScreen : public Activity {
  private:
   float languageXPos[3] = {640, 640, 640};
   SaveManager& save_file_;
+  TiledBackground background_{img_background};
   std::string GetName();
 
   float previous_time = 0.f;
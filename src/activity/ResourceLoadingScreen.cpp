@@ -2,6 +2,7 @@
 #include <cmath>
 #include <smk/Color.hpp>
 #include <smk/Text.hpp>
+#include "game/TextCache.hpp"
 
 void ResourceLoadingScreen::Draw() {
   window().PoolEvents();
@@ -24,13 +25,9 @@ void ResourceLoadingScreen::Draw() {
     return;
   }
 
-  smk::Text text;
-  text.SetFont(font_arial);
-  text.SetString("Press space to start");
-  text.SetColor(smk::Color::White * float(0.5f + 0.4f * sin(time * 8.f)));
-  text.SetPosition({10.f, 480.f - 60.f});
-
-  window().Draw(text);
+  text_cache.Draw(window(), font_arial, L"Press space to start",
+                  {10.f, 480.f - 60.f},
+                  smk::Color::White * float(0.5f + 0.4f * sin(time * 8.f)));
 
   if (window().input().IsKeyPressed(GLFW_KEY_SPACE))
     on_desktop_device();
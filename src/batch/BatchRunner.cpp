@@ -0,0 +1,131 @@
+#include "batch/BatchRunner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+class JobQueue {
+ public:
+  void Push(int job) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back(job);
+  }
+
+  // The owner works from the back...
+  bool Pop(int& job) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (jobs_.empty())
+      return false;
+    job = jobs_.back();
+    jobs_.pop_back();
+    return true;
+  }
+
+  // ... while the thieves take from the front.
+  bool Steal(int& job) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (jobs_.empty())
+      return false;
+    job = jobs_.front();
+    jobs_.pop_front();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::deque<int> jobs_;
+};
+
+// Keep every direction for a few ticks, like a player would.
+Input::T RandomInput(Random& random, int tick, int& current) {
+  if (tick % 8 == 0) {
+    current = random.Rand() % 16;  // Left, Right, Up, Space.
+    if (random.Rand() % 4 == 0)
+      current |= Input::Next;
+  }
+  return Input::T(current);
+}
+
+}  // namespace
+
+BatchResult RunBatchJob(const BatchJob& job, JobSystem* level_jobs) {
+  Level level(job.seed);
+  level.job_system = level_jobs;
+  level.fixed_point = job.fixed_point;
+  level.LoadFromFile(job.level);
+
+  Random random(job.seed);
+  int current = Input::None;
+
+  BatchResult result;
+  for (result.ticks = 0; result.ticks < job.ticks;) {
+    Input::T input = job.inputs.empty()
+                         ? RandomInput(random, result.ticks, current)
+                         : job.inputs[result.ticks % job.inputs.size()];
+
+    // A random player shouldn't give up or restart.
+    if (job.inputs.empty())
+      input = Input::T(input & ~(Input::Escape | Input::Restart));
+
+    level.Step(input);
+    result.ticks++;
+    if (job.hash_interval && result.ticks % job.hash_interval == 0)
+      result.hashes.push_back(level.state_hash());
+
+    if (level.isWin || level.isLose || level.isEscape)
+      break;
+  }
+  result.win = level.isWin;
+  result.lose = level.isLose;
+  return result;
+}
+
+BatchRunner::BatchRunner(int threads, int level_threads)
+    : threads_(std::max(1, threads)), level_threads_(level_threads) {}
+
+std::vector<BatchResult> BatchRunner::Run(const std::vector<BatchJob>& jobs) {
+  std::vector<BatchResult> results(jobs.size());
+  std::vector<std::unique_ptr<JobQueue>> queues;
+  for (int i = 0; i < threads_; ++i)
+    queues.push_back(std::make_unique<JobQueue>());
+  for (size_t i = 0; i < jobs.size(); ++i)
+    queues[i % threads_]->Push(i);
+
+  auto start = std::chrono::steady_clock::now();
+
+  // No job creates new jobs. Once every queue is empty, the work is done.
+  auto worker = [&](int self) {
+    std::unique_ptr<JobSystem> level_jobs;
+    if (level_threads_ > 1)
+      level_jobs = std::make_unique<JobSystem>(level_threads_);
+
+    int job;
+    for (;;) {
+      bool found = queues[self]->Pop(job);
+      for (int i = 1; !found && i < threads_; ++i)
+        found = queues[(self + i) % threads_]->Steal(job);
+      if (!found)
+        return;
+      results[job] = RunBatchJob(jobs[job], level_jobs.get());
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < threads_; ++i)
+    threads.emplace_back(worker, i);
+  for (auto& thread : threads)
+    thread.join();
+
+  auto end = std::chrono::steady_clock::now();
+  seconds_ = std::chrono::duration<double>(end - start).count();
+  total_ticks_ = 0;
+  for (const BatchResult& result : results)
+    total_ticks_ += result.ticks;
+
+  return results;
+}
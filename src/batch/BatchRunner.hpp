@@ -0,0 +1,61 @@
+#ifndef BATCH_BATCH_RUNNER_HPP
+#define BATCH_BATCH_RUNNER_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "game/Level.hpp"
+
+// One Level simulation, independent of every other.
+struct BatchJob {
+  std::string level;
+  int seed = 1;
+  int ticks = 1000;
+  bool fixed_point = false;  // See Level::fixed_point.
+
+  // The input of each tick. When empty, random inputs are generated from
+  // |seed|.
+  std::vector<Input::T> inputs;
+
+  // Record Level::state_hash() every |hash_interval| ticks.
+  int hash_interval = 0;
+};
+
+struct BatchResult {
+  int ticks = 0;  // Simulated, it can be less than BatchJob::ticks.
+  bool win = false;
+  bool lose = false;
+
+  // After tick |hash_interval|, 2 * |hash_interval|, ...
+  std::vector<uint64_t> hashes;
+};
+
+// Run many BatchJob on every core. Each thread owns a queue of jobs. It takes
+// from its own queue first, and steals from the others once it is empty.
+// Needs no window: loading and stepping a Level make no GL call.
+class BatchRunner {
+ public:
+  // With |level_threads| > 1, every Level also runs the independent phases of
+  // its Step on that many threads.
+  explicit BatchRunner(int threads, int level_threads = 1);
+
+  // Results are in the same order as |jobs|.
+  std::vector<BatchResult> Run(const std::vector<BatchJob>& jobs);
+
+  // About the last Run:
+  long total_ticks() const { return total_ticks_; }
+  double seconds() const { return seconds_; }
+  double ticks_per_second() const { return total_ticks_ / seconds_; }
+  int threads() const { return threads_; }
+
+ private:
+  int threads_;
+  int level_threads_;
+  long total_ticks_ = 0;
+  double seconds_ = 0.0;
+};
+
+// Simulate a single job on the calling thread.
+BatchResult RunBatchJob(const BatchJob& job, JobSystem* level_jobs = nullptr);
+
+#endif /* BATCH_BATCH_RUNNER_HPP */
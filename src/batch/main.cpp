@@ -0,0 +1,161 @@
+// Simulate levels without a window, on every core.
+//
+// Usage: inthecube_batch [-j threads] [-p threads per level] [-t ticks]
+//                        [-s seeds] [-h hash interval] [-x] <level files>
+//        inthecube_batch [-j threads] -v <hash file>
+//
+// Every level is played once per seed, with random inputs. With -x, in the
+// fixed point mode (see Level::fixed_point).
+//
+// With -h, the hash of the state is printed every few ticks, on lines
+// starting with "hashes". Given such an output from another build, -v plays
+// the same simulations, in the same mode, and reports where they diverge.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "batch/BatchRunner.hpp"
+#include "game/StateHash.hpp"
+
+namespace {
+
+// A line of the output of -h:
+// hashes <level> <seed> <interval> <float|fixed> <hash> <hash> ...
+struct Hashes {
+  BatchJob job;
+  std::vector<uint64_t> hashes;
+};
+
+std::vector<Hashes> ReadHashes(const std::string& filename) {
+  std::vector<Hashes> out;
+  std::ifstream file(filename);
+  std::string line;
+  while (std::getline(file, line)) {
+    std::stringstream ss(line);
+    std::string identifier;
+    Hashes hashes;
+    if (!(ss >> identifier) || identifier != "hashes")
+      continue;
+    std::string mode;
+    ss >> hashes.job.level >> hashes.job.seed >> hashes.job.hash_interval >>
+        mode;
+    hashes.job.fixed_point = mode == "fixed";
+    uint64_t hash;
+    while (ss >> std::hex >> hash)
+      hashes.hashes.push_back(hash);
+    hashes.job.ticks = hashes.job.hash_interval * hashes.hashes.size();
+    if (hashes.job.hash_interval > 0)
+      out.push_back(hashes);
+  }
+  return out;
+}
+
+int Verify(BatchRunner& runner, const std::string& filename) {
+  std::vector<Hashes> expected = ReadHashes(filename);
+  std::vector<BatchJob> jobs;
+  for (const Hashes& it : expected)
+    jobs.push_back(it.job);
+  std::vector<BatchResult> results = runner.Run(jobs);
+
+  int diverged = 0;
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    const BatchJob& job = jobs[i];
+    int first = FirstDivergence(expected[i].hashes, results[i].hashes);
+    if (first == -1) {
+      printf("%s seed=%d same\n", job.level.c_str(), job.seed);
+      continue;
+    }
+    diverged++;
+    printf("%s seed=%d diverges between tick %d and %d\n", job.level.c_str(),
+           job.seed, first * job.hash_interval + 1,
+           (first + 1) * job.hash_interval);
+  }
+  printf("%zu simulations, %d diverged\n", jobs.size(), diverged);
+  return diverged ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int threads = std::thread::hardware_concurrency();
+  int ticks = 3000;
+  int seeds = 1;
+  int level_threads = 1;
+  int hash_interval = 0;
+  bool fixed_point = false;
+  std::string verify;
+  std::vector<std::string> levels;
+
+  for (int i = 1; i < argc; ++i) {
+    if (i + 1 < argc && !strcmp(argv[i], "-j"))
+      threads = atoi(argv[++i]);
+    else if (i + 1 < argc && !strcmp(argv[i], "-p"))
+      level_threads = atoi(argv[++i]);
+    else if (i + 1 < argc && !strcmp(argv[i], "-t"))
+      ticks = atoi(argv[++i]);
+    else if (i + 1 < argc && !strcmp(argv[i], "-s"))
+      seeds = atoi(argv[++i]);
+    else if (i + 1 < argc && !strcmp(argv[i], "-h"))
+      hash_interval = atoi(argv[++i]);
+    else if (i + 1 < argc && !strcmp(argv[i], "-v"))
+      verify = argv[++i];
+    else if (!strcmp(argv[i], "-x"))
+      fixed_point = true;
+    else
+      levels.push_back(argv[i]);
+  }
+
+  if (!verify.empty()) {
+    BatchRunner runner(threads, level_threads);
+    return Verify(runner, verify);
+  }
+
+  if (levels.empty()) {
+    fprintf(stderr,
+            "Usage: %s [-j threads] [-p threads per level] [-t ticks] "
+            "[-s seeds] [-h hash interval] [-x] <level files>\n"
+            "       %s [-j threads] -v <hash file>\n",
+            argv[0], argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  std::vector<BatchJob> jobs;
+  for (const std::string& level : levels) {
+    for (int seed = 1; seed <= seeds; ++seed) {
+      BatchJob job;
+      job.level = level;
+      job.seed = seed;
+      job.ticks = ticks;
+      job.hash_interval = hash_interval;
+      job.fixed_point = fixed_point;
+      jobs.push_back(job);
+    }
+  }
+
+  BatchRunner runner(threads, level_threads);
+  std::vector<BatchResult> results = runner.Run(jobs);
+
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    const char* outcome = results[i].win ? "win" : results[i].lose ? "lose" : "-";
+    printf("%s seed=%d ticks=%d %s\n", jobs[i].level.c_str(), jobs[i].seed,
+           results[i].ticks, outcome);
+  }
+
+  for (size_t i = 0; i < jobs.size() && hash_interval > 0; ++i) {
+    printf("hashes %s %d %d %s", jobs[i].level.c_str(), jobs[i].seed,
+           hash_interval, fixed_point ? "fixed" : "float");
+    for (uint64_t hash : results[i].hashes)
+      printf(" %016llx", (unsigned long long)hash);
+    printf("\n");
+  }
+
+  printf("%zu simulations, %ld ticks in %.2fs on %d threads: %.0f ticks/s\n",
+         jobs.size(), runner.total_ticks(), runner.seconds(), runner.threads(),
+         runner.ticks_per_second());
+  return EXIT_SUCCESS;
+}
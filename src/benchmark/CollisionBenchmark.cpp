@@ -0,0 +1,143 @@
+// Compare the collision kernels on the static blocks of real levels.
+//
+// Usage: inthecube_collision_benchmark resources/lvl/Level*
+//
+// Every query is a Hero sized box placed randomly around the blocks, like the
+// ones PlaceFree() tests. All the methods must agree on every query.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "game/BoxBatch.hpp"
+#include "game/Collision.hpp"
+
+namespace {
+
+// The blocks and invisible blocks, like Level::static_boxes_.
+std::vector<Rectangle> LoadStaticBlocks(const char* filename) {
+  std::vector<Rectangle> blocks;
+  std::ifstream file(filename);
+  std::string line;
+  while (std::getline(file, line)) {
+    std::stringstream ss(line);
+    std::string identifier;
+    ss >> identifier;
+    if (identifier != "b" && identifier != "i")
+      continue;
+    int x, y, width, height;
+    ss >> x >> y >> width >> height;
+    blocks.push_back(Rectangle(x, x + width, y + height, y));
+  }
+  return blocks;
+}
+
+template <typename F>
+double Measure(const std::vector<Rectangle>& queries,
+               std::vector<char>& results,
+               F f) {
+  const int repeat = 20;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeat; ++r) {
+    for (size_t i = 0; i < queries.size(); ++i)
+      results[i] = f(queries[i]);
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         (repeat * queries.size());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::fprintf(stderr, "Usage: %s <level files>\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  struct Method {
+    const char* name;
+    double nanoseconds = 0;
+  };
+  std::vector<Method> methods = {
+      {"IsCollision loop"},
+      {"scalar batch"},
+      {"SSE batch"},
+      {"AVX2 batch"},
+  };
+  BoxKernel kernels[] = {
+      GetBoxKernel(BoxKernelIsa::Scalar),
+      GetBoxKernel(BoxKernelIsa::SSE),
+      GetBoxKernel(BoxKernelIsa::AVX2),
+  };
+
+  std::mt19937 rng(0);
+  int levels = 0;
+  for (int i = 1; i < argc; ++i) {
+    std::vector<Rectangle> blocks = LoadStaticBlocks(argv[i]);
+    if (blocks.empty())
+      continue;
+    levels++;
+
+    BoxBatch batch;
+    Rectangle bounds = blocks.front();
+    for (const Rectangle& block : blocks) {
+      batch.Add(block);
+      bounds.left = std::min(bounds.left, block.left);
+      bounds.top = std::min(bounds.top, block.top);
+      bounds.right = std::max(bounds.right, block.right);
+      bounds.bottom = std::max(bounds.bottom, block.bottom);
+    }
+
+    std::uniform_real_distribution<float> x(bounds.left - 32, bounds.right);
+    std::uniform_real_distribution<float> y(bounds.top - 32, bounds.bottom);
+    // Already normalized, they can be given to the kernels directly.
+    std::vector<Rectangle> queries;
+    for (int q = 0; q < 20000; ++q) {
+      float left = x(rng);
+      float top = y(rng);
+      queries.push_back(Rectangle(left, left + 29, top + 29, top));
+    }
+
+    std::vector<char> expected(queries.size());
+    std::vector<char> results(queries.size());
+
+    methods[0].nanoseconds += Measure(queries, expected, [&](Rectangle q) {
+      for (const Rectangle& block : blocks) {
+        if (IsCollision(q, block))
+          return true;
+      }
+      return false;
+    });
+
+    for (int k = 0; k < 3; ++k) {
+      if (!kernels[k])
+        continue;
+      BoxKernelInput input = batch.Input(0, batch.size());
+      methods[1 + k].nanoseconds += Measure(
+          queries, results, [&](Rectangle q) { return kernels[k](input, q); });
+      if (results != expected) {
+        std::fprintf(stderr, "%s: %s disagrees\n", argv[i],
+                     methods[1 + k].name);
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  std::printf("%d levels\n", levels);
+  for (size_t k = 0; k < methods.size(); ++k) {
+    if (k >= 1 && k <= 3 && !kernels[k - 1]) {
+      std::printf("%-18s unsupported\n", methods[k].name);
+      continue;
+    }
+    std::printf("%-18s %8.2f ns/query  x%.2f\n", methods[k].name,
+                methods[k].nanoseconds / levels,
+                methods[0].nanoseconds / methods[k].nanoseconds);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,202 @@
+// Measure the cost of drawing the levels, in a hidden window.
+//
+// Usage: inthecube_render_benchmark [-f frames] [level files]
+//
+// Without level files, every level of resources/lvl/LevelList is played. Each
+// one follows the same input script, and is drawn into a framebuffer once per
+// tick. The timings go to stderr. stdout gets a checksum of every frame, to
+// check that a change of the drawing code leaves the pixels unchanged:
+//
+//   ./inthecube_render_benchmark > before.txt
+//   ./inthecube_render_benchmark > after.txt
+//   diff before.txt after.txt
+//
+// Without a display (CI, ssh), the context is created by OSMesa on the null
+// platform of GLFW, from 3.4. It needs libOSMesa, and measures the software
+// renderer, not the GPU. With an older GLFW, use a virtual display instead:
+//
+//   xvfb-run -a ./inthecube_render_benchmark > checksums.txt
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <smk/Color.hpp>
+#include <smk/Framebuffer.hpp>
+#include <smk/OpenGL.hpp>
+#include <smk/Window.hpp>
+#include "game/DrawList.hpp"
+#include "game/Level.hpp"
+#include "game/LevelListLoader.hpp"
+#include "game/Resource.hpp"
+
+namespace {
+
+const int kWidth = 640;
+const int kHeight = 480;
+
+// Played in a loop. Every level receives the same inputs.
+struct ScriptEntry {
+  int ticks;
+  int input;
+};
+// clang-format off
+const ScriptEntry kScript[] = {
+  {30, Input::None},
+  {60, Input::Right},
+  {20, Input::Right | Input::Up},
+  {40, Input::Left},
+  {10, Input::Space},
+  {30, Input::Left | Input::Up},
+  {5,  Input::Next},
+};
+// clang-format on
+
+Input::T ScriptInput(int tick) {
+  int length = 0;
+  for (const ScriptEntry& entry : kScript)
+    length += entry.ticks;
+  tick %= length;
+  for (const ScriptEntry& entry : kScript) {
+    if (tick < entry.ticks)
+      return Input::T(entry.input);
+    tick -= entry.ticks;
+  }
+  return Input::None;
+}
+
+// FNV-1a.
+uint64_t Checksum(const std::vector<uint8_t>& data) {
+  uint64_t hash = 14695981039346656037ull;
+  for (uint8_t byte : data) {
+    hash ^= byte;
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+// Initialize GLFW on the display, or on no display at all when it can.
+bool InitGlfw() {
+  if (glfwInit())
+    return true;
+#if defined(GLFW_PLATFORM_NULL)
+  glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+  if (glfwInit()) {
+    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+    return true;
+  }
+#endif
+  return false;
+}
+
+struct Stats {
+  std::vector<double> cpu_ms;
+  long draw_calls = 0;
+  long triangles = 0;
+
+  void Print(const char* name) const {
+    std::vector<double> sorted = cpu_ms;
+    std::sort(sorted.begin(), sorted.end());
+    double sum = 0.0;
+    for (double ms : sorted)
+      sum += ms;
+    int frames = std::max<int>(1, sorted.size());
+    fprintf(stderr,
+            "%s: %zu frames, cpu %.3f ms (p95 %.3f ms), %ld draw calls, "
+            "%ld triangles per frame\n",
+            name, sorted.size(), sum / frames,
+            sorted.empty() ? 0.0 : sorted[sorted.size() * 95 / 100],
+            draw_calls / frames, triangles / frames);
+  }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int frames = 300;
+  std::vector<std::string> levels;
+  for (int i = 1; i < argc; ++i) {
+    if (i + 1 < argc && !strcmp(argv[i], "-f"))
+      frames = atoi(argv[++i]);
+    else
+      levels.push_back(argv[i]);
+  }
+
+  if (levels.empty()) {
+    levels = LevelListLoader();
+    // The first entry is the intro, not a level.
+    if (!levels.empty())
+      levels.erase(levels.begin());
+  }
+
+  // Only the GL context of the window is used.
+  if (!InitGlfw()) {
+    fprintf(stderr, "No display for a GL context. Try with xvfb-run -a.\n");
+    return EXIT_FAILURE;
+  }
+  glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+  smk::Window window(kWidth, kHeight, "InTheCube render benchmark");
+
+  // The sounds are not needed.
+  ResourceInitializer initializer;
+  for (auto& resource : initializer.resources) {
+    if (!resource.soundbuffer)
+      resource.Load();
+  }
+
+  smk::Framebuffer framebuffer(kWidth, kHeight);
+  std::vector<uint8_t> pixels(kWidth * kHeight * 4);
+  GLuint query = 0;
+  glGenQueries(1, &query);
+
+  DrawList list;
+  Stats total;
+  for (const std::string& filename : levels) {
+    Level level(1);
+    level.LoadFromFile(filename);
+
+    Stats stats;
+    for (int frame = 0; frame < frames; ++frame) {
+      level.Step(ScriptInput(frame));
+      if (level.isWin || level.isLose || level.isEscape)
+        break;
+
+      auto start = std::chrono::steady_clock::now();
+      list.Clear();
+      level.Draw(list);
+      framebuffer.Clear(smk::Color::Black);
+      glBeginQuery(GL_PRIMITIVES_GENERATED, query);
+      list.Execute(framebuffer);
+      glEndQuery(GL_PRIMITIVES_GENERATED);
+      auto end = std::chrono::steady_clock::now();
+
+      GLuint triangles = 0;
+      glGetQueryObjectuiv(query, GL_QUERY_RESULT, &triangles);
+
+      // The framebuffer is still bound from the last draw call.
+      glReadPixels(0, 0, kWidth, kHeight, GL_RGBA, GL_UNSIGNED_BYTE,
+                   pixels.data());
+      printf("%s %d %016llx\n", filename.c_str(), frame,
+             (unsigned long long)Checksum(pixels));
+
+      stats.cpu_ms.push_back(
+          std::chrono::duration<double, std::milli>(end - start).count());
+      stats.draw_calls += list.draw_calls();
+      stats.triangles += triangles;
+    }
+
+    stats.Print(filename.c_str());
+    total.cpu_ms.insert(total.cpu_ms.end(), stats.cpu_ms.begin(),
+                        stats.cpu_ms.end());
+    total.draw_calls += stats.draw_calls;
+    total.triangles += stats.triangles;
+  }
+
+  glDeleteQueries(1, &query);
+  total.Print("total");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,88 @@
+// Checks FileWriter. A burst of writes to one file ends with its last content,
+// written once the calls stopped for the debounce delay. A write without
+// debounce is not held back by the others. What is pending when the writer is
+// destroyed still reaches the disk. Exits with a failure otherwise.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "game/FileWriter.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const std::string kSave = "file_writer_check_save";
+const std::string kGhost = "file_writer_check_ghost";
+
+bool Read(const std::string& path, std::string& content) {
+  std::ifstream file(path);
+  if (!file)
+    return false;
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  content = buffer.str();
+  return true;
+}
+
+// Wait until |path| holds |expected|, for at most a few seconds.
+bool WaitFor(const std::string& path, const std::string& expected) {
+  auto deadline = Clock::now() + std::chrono::seconds(5);
+  std::string content;
+  while (Clock::now() < deadline) {
+    if (Read(path, content) && content == expected)
+      return true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return false;
+}
+
+int failures = 0;
+void Check(bool condition, const char* what) {
+  if (condition)
+    return;
+  std::fprintf(stderr, "FAILED: %s\n", what);
+  ++failures;
+}
+
+}  // namespace
+
+int main() {
+  std::remove(kSave.c_str());
+  std::remove(kGhost.c_str());
+  const auto debounce = std::chrono::milliseconds(250);
+
+  {
+    FileWriter writer;
+    for (int i = 0; i < 1000; ++i)
+      writer.Write(kSave, std::to_string(i), debounce);
+    auto last_write = Clock::now();
+    writer.Write(kGhost, "ghost");
+
+    Check(WaitFor(kGhost, "ghost"), "a write without debounce is done");
+    std::string content;
+    Check(!Read(kSave, content) || Clock::now() - last_write >= debounce,
+          "a debounced write waits for the calls to stop");
+
+    Check(WaitFor(kSave, "999"), "a burst is written with its last content");
+    Check(Clock::now() - last_write >= debounce,
+          "a burst is written after the debounce delay");
+
+    writer.Write(kSave, "pending", std::chrono::seconds(60));
+  }
+  std::string content;
+  Check(Read(kSave, content) && content == "pending",
+        "the destructor writes what is pending");
+  Check(!Read(kSave + ".tmp", content), "no temporary file is left");
+
+  std::remove(kSave.c_str());
+  std::remove(kGhost.c_str());
+  if (failures)
+    return EXIT_FAILURE;
+  std::printf("FileWriter: OK\n");
+  return EXIT_SUCCESS;
+}
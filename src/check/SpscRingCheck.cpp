@@ -0,0 +1,49 @@
+// Checks SpscRing. One thread pushes a sequence of numbers while another pops
+// them with Pop and PopAll, so the ring is often full and often wraps around.
+// Every number must come out once, in order. Exits with a failure otherwise.
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include "game/SpscRing.hpp"
+
+int main() {
+  SpscRing<int, 64> ring;
+  const int count = 200000;
+
+  std::thread producer([&] {
+    for (int i = 0; i < count;) {
+      if (ring.Push(i))
+        ++i;
+      else
+        std::this_thread::yield();
+    }
+  });
+
+  int expected = 0;
+  bool in_order = true;
+  while (expected < count) {
+    if (expected % 3 == 0) {
+      int value;
+      if (ring.Pop(value))
+        in_order &= value == expected++;
+    } else {
+      ring.PopAll([&](const int* values, size_t size) {
+        for (size_t i = 0; i < size; ++i)
+          in_order &= values[i] == expected++;
+      });
+    }
+    std::this_thread::yield();
+  }
+  producer.join();
+
+  int value;
+  bool empty = !ring.Pop(value);
+  if (!in_order || !empty) {
+    std::fprintf(stderr, "FAILED: %s\n",
+                 in_order ? "values left in the ring" : "values out of order");
+    return EXIT_FAILURE;
+  }
+  std::printf("SpscRing: %d values, OK\n", count);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,95 @@
+// Checks Telemetry. Events recorded while the background thread writes the
+// log reach it in order and intact, except the ones counted as dropped. A log
+// reopened later is appended to. Exits with a failure otherwise.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "game/Telemetry.hpp"
+
+namespace {
+
+const std::string kLog = "telemetry_check_log";
+
+TelemetryEvent Event(int i) {
+  TelemetryEvent event;
+  event.level = 42;
+  event.tick = i;
+  event.x = i * 0.5f;
+  event.y = -i * 0.25f;
+  event.type = TelemetryType::Death;
+  event.cause = DeathCause(i % 7);
+  event.special = uint16_t(i);
+  return event;
+}
+
+bool Same(const TelemetryEvent& a, const TelemetryEvent& b) {
+  return a.level == b.level && a.tick == b.tick && a.x == b.x &&
+         a.y == b.y && a.type == b.type && a.cause == b.cause &&
+         a.special == b.special;
+}
+
+int failures = 0;
+void Check(bool condition, const char* what) {
+  if (condition)
+    return;
+  std::fprintf(stderr, "FAILED: %s\n", what);
+  ++failures;
+}
+
+}  // namespace
+
+int main() {
+  std::remove(kLog.c_str());
+
+  int recorded = 0;
+  int dropped = 0;
+  {
+    Telemetry telemetry(kLog);
+    // Longer than the flush period, so that the thread writes while events
+    // are recorded.
+    auto end =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(2500);
+    while (std::chrono::steady_clock::now() < end) {
+      telemetry.Record(Event(recorded++));
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    dropped = telemetry.dropped();
+  }
+  {
+    Telemetry telemetry(kLog);
+    telemetry.Record(Event(recorded++));
+  }
+
+  std::ifstream file(kLog, std::ios::binary);
+  char magic[sizeof(kTelemetryMagic)];
+  Check(file.read(magic, sizeof(magic)) &&
+            !std::memcmp(magic, kTelemetryMagic, sizeof(magic)),
+        "the log starts with the magic");
+  std::vector<TelemetryEvent> events;
+  TelemetryEvent event;
+  while (file.read(reinterpret_cast<char*>(&event), sizeof(event)))
+    events.push_back(event);
+
+  Check(int(events.size()) == recorded - dropped,
+        "every event is written or counted as dropped");
+  bool intact = true;
+  for (size_t i = 0; i < events.size(); ++i) {
+    intact &= Same(events[i], Event(events[i].tick));
+    intact &= i == 0 || events[i - 1].tick < events[i].tick;
+  }
+  Check(intact, "the events are written in order and intact");
+  Check(!events.empty() && events.back().tick == recorded - 1,
+        "a reopened log is appended to");
+
+  std::remove(kLog.c_str());
+  if (failures)
+    return EXIT_FAILURE;
+  std::printf("Telemetry: %d events, %d dropped, OK\n", recorded, dropped);
+  return EXIT_SUCCESS;
+}
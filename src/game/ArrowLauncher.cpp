@@ -1,18 +1,31 @@
 #include "ArrowLauncher.hpp"
 
+#include <cmath>
+#include "game/Fixed.hpp"
 #include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
 #include <smk/Window.hpp>
 
+namespace {
+const SpriteTemplate kArrowLauncher(img_arrowLauncher);
+}  // namespace
+
 ArrowLauncher::ArrowLauncher(float X, float Y, float O) {
-  sprite = smk::Sprite(img_arrowLauncher);
-  sound = smk::Sound(SB_arrowLauncher);
+  sound = SoundSource(SB_arrowLauncher);
   x = X;
   y = Y;
   orientation = O;
-  sprite.SetPosition(x, y);
-  sound.SetLoop(false);
 }
 
-void ArrowLauncher::Draw(smk::Window& window) {
-  window.Draw(sprite);
+void ArrowLauncher::Draw(DrawList& target) {
+  target.Draw(kArrowLauncher.At(x, y));
+}
+
+glm::vec2 ArrowLauncher::ArrowSpeed(bool fixed_point) const {
+  if (fixed_point) {
+    int degrees = std::lround(orientation);
+    return {float(17 * CosDegrees(degrees)), -float(17 * SinDegrees(degrees))};
+  }
+  return {+17 * cos(orientation * .0174532925),
+          -17 * sin(orientation * .0174532925)};
 }
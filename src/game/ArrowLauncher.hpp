@@ -1,8 +1,9 @@
 #ifndef GAME_ARROW_LAUNCHER_HPP
 #define GAME_ARROW_LAUNCHER_HPP
 
-#include <smk/Sound.hpp>
-#include <smk/Sprite.hpp>
+#include <glm/glm.hpp>
+#include "game/DrawList.hpp"
+#include "game/SoundSource.hpp"
 
 namespace smk {
 class Window;
@@ -11,12 +12,14 @@ class Window;
 class ArrowLauncher {
  public:
   float x, y;
-  smk::Sprite sprite;
-  smk::Sound sound;
+  SoundSource sound;
   float orientation;
 
   ArrowLauncher(float X, float Y, float Orientation);
-  void Draw(smk::Window& window);
+  void Draw(DrawList& target);
+  // The speed of the arrows it throws. With |fixed_point|, from the table
+  // based trigonometry.
+  glm::vec2 ArrowSpeed(bool fixed_point) const;
 };
 
 #endif /* GAME_ARROW_LAUNCHER_HPP */
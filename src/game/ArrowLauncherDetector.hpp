@@ -9,6 +9,7 @@ struct ArrowLauncherDetector {
   ArrowLauncherDetector(int l, int r, int t, int b, int Mode, int LauncherID);
   int mode;  // 0=single shoot, 1=one soot every second
   int t;
+  int sensor = -1;
 };
 
 #endif /* GAME_ARROW_LAUNCHER_DETECTOR_HPP */
@@ -0,0 +1,60 @@
+#include "game/ArrowPool.hpp"
+
+#include <cmath>
+#include <smk/Window.hpp>
+#include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
+
+namespace {
+const SpriteTemplate kArrow(img_arrow, [](smk::Sprite& sprite) {
+  sprite.SetCenter(24, 8);
+});
+}  // namespace
+
+ArrowPool::ArrowPool() {
+  active.reserve(capacity);
+  position.resize(capacity);
+  speed.resize(capacity);
+  angle.resize(capacity);
+  alpha.resize(capacity);
+  damage.resize(capacity);
+
+  free_.reserve(capacity);
+  for (int slot = capacity - 1; slot >= 0; --slot)
+    free_.push_back(slot);
+}
+
+void ArrowPool::Spawn(glm::vec2 p, glm::vec2 s) {
+  if (free_.empty()) {
+    // The pool is full. Recycle the oldest arrow already planted somewhere. If
+    // every arrow is still flying, drop the new one.
+    auto oldest = active.begin();
+    while (oldest != active.end() && !damage[*oldest])
+      ++oldest;
+    if (oldest == active.end())
+      return;
+    free_.push_back(*oldest);
+    active.erase(oldest);
+  }
+
+  int slot = free_.back();
+  free_.pop_back();
+  active.push_back(slot);
+
+  position[slot] = p;
+  speed[slot] = s;
+  angle[slot] = std::atan2(-s.y, s.x) * 57.3;
+  alpha[slot] = 255;
+  damage[slot] = false;
+}
+
+void ArrowPool::Draw(DrawList& target) {
+  for (int slot : active) {
+    if (alpha[slot] == 0)
+      continue;
+    auto sprite = kArrow.At(position[slot].x, position[slot].y);
+    sprite.SetRotation(angle[slot]);
+    sprite.SetColor(glm::vec4(1.f, 1.f, 1.f, alpha[slot] / 255.f));
+    target.Draw(sprite);
+  }
+}
@@ -0,0 +1,52 @@
+#ifndef GAME_ARROW_POOL_HPP
+#define GAME_ARROW_POOL_HPP
+
+#include <glm/glm.hpp>
+#include <vector>
+#include "game/DrawList.hpp"
+
+namespace smk {
+class Window;
+}  // namespace smk
+
+// Every arrow of the level, stored as flat arrays indexed by a slot. The
+// storage is allocated once; spawning and retiring arrows only moves slots
+// between the |active| and the free list.
+class ArrowPool {
+ public:
+  static constexpr int capacity = 4096;
+
+  ArrowPool();
+  void Spawn(glm::vec2 position, glm::vec2 speed);
+  void Draw(DrawList& target);
+
+  // Release every slot for which |retire(slot)| is true.
+  template <typename Predicate>
+  void Retire(Predicate retire);
+
+  // Slots in use, oldest first.
+  std::vector<int> active;
+
+  std::vector<glm::vec2> position;
+  std::vector<glm::vec2> speed;
+  std::vector<float> angle;
+  std::vector<int> alpha;
+  std::vector<char> damage;
+
+ private:
+  std::vector<int> free_;
+};
+
+template <typename Predicate>
+void ArrowPool::Retire(Predicate retire) {
+  size_t kept = 0;
+  for (int slot : active) {
+    if (retire(slot))
+      free_.push_back(slot);
+    else
+      active[kept++] = slot;
+  }
+  active.resize(kept);
+}
+
+#endif /* GAME_ARROW_POOL_HPP */
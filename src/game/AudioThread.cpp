@@ -0,0 +1,167 @@
+#include "game/AudioThread.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// How often the audio thread runs the commands and the fades.
+const auto kPeriod = std::chrono::milliseconds(5);
+
+}  // namespace
+
+AudioThread::Voice AudioThread::Queue::Play(const smk::SoundBuffer& buffer,
+                                          SoundPriority priority,
+                                          float volume,
+                                          bool loop) {
+  Voice voice = ++audio_.last_voice_;
+  Command command{Type::Play, voice};
+  command.buffer = &buffer;
+  command.priority = priority;
+  command.volume = volume;
+  command.loop = loop;
+  Push(command);
+  return voice;
+}
+
+void AudioThread::Queue::Stop(Voice voice) {
+  Push(Command{Type::Stop, voice});
+}
+
+void AudioThread::Queue::SetVolume(Voice voice, float volume) {
+  Command command{Type::Volume, voice};
+  command.volume = volume;
+  Push(command);
+}
+
+void AudioThread::Queue::Fade(Voice voice, float volume, float seconds) {
+  Command command{Type::Fade, voice};
+  command.volume = volume;
+  command.seconds = seconds;
+  Push(command);
+}
+
+void AudioThread::Queue::Push(const Command& command) {
+  if (!ring_.Push(command))
+    audio_.dropped_++;
+}
+
+AudioThread::AudioThread() : time_(std::chrono::steady_clock::now()) {
+#ifndef __EMSCRIPTEN__
+  thread_ = std::thread(&AudioThread::Work, this);
+#endif
+}
+
+AudioThread::~AudioThread() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    quit_ = true;
+  }
+  wake_.notify_one();
+  if (thread_.joinable())
+    thread_.join();
+}
+
+void AudioThread::Step() {
+#ifdef __EMSCRIPTEN__
+  Update();
+#endif
+}
+
+void AudioThread::Work() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!wake_.wait_for(lock, kPeriod, [&] { return quit_; }))
+    Update();
+}
+
+void AudioThread::Update() {
+  auto now = std::chrono::steady_clock::now();
+  float elapsed = std::chrono::duration<float>(now - time_).count();
+  time_ = now;
+
+  Queue::Command command;
+  while (music_.ring_.Pop(command))
+    Run(command);
+  while (level_.ring_.Pop(command))
+    Run(command);
+
+  for (Channel& channel : channels_) {
+    if (!channel.voice || !channel.fading)
+      continue;
+    float step = channel.speed * elapsed;
+    if (std::abs(channel.target - channel.volume) <= step) {
+      channel.volume = channel.target;
+      channel.fading = false;
+    } else {
+      channel.volume += channel.volume < channel.target ? step : -step;
+    }
+    channel.sound.SetVolume(channel.volume);
+    if (!channel.fading && channel.volume == 0.f) {
+      channel.sound.Stop();
+      channel.voice = 0;
+    }
+  }
+}
+
+void AudioThread::Run(const Queue::Command& command) {
+  if (command.type == Queue::Type::Play) {
+    Channel* channel = Pick(command.priority);
+    if (!channel)
+      return;
+    channel->sound = smk::Sound(*command.buffer);
+    channel->sound.SetLoop(command.loop);
+    channel->sound.SetVolume(command.volume);
+    channel->sound.Play();
+    channel->voice = command.voice;
+    channel->priority = command.priority;
+    channel->started = ++plays_;
+    channel->volume = command.volume;
+    channel->target = command.volume;
+    channel->fading = false;
+    return;
+  }
+
+  Channel* channel = Find(command.voice);
+  if (!channel)
+    return;
+  switch (command.type) {
+    case Queue::Type::Stop:
+      channel->sound.Stop();
+      channel->voice = 0;
+      break;
+    case Queue::Type::Volume:
+      channel->volume = channel->target = command.volume;
+      channel->fading = false;
+      channel->sound.SetVolume(command.volume);
+      break;
+    case Queue::Type::Fade:
+      channel->target = command.volume;
+      channel->speed = std::abs(command.volume - channel->volume) /
+                       std::max(command.seconds, 0.001f);
+      channel->fading = true;
+      break;
+    case Queue::Type::Play:
+      break;
+  }
+}
+
+AudioThread::Channel* AudioThread::Find(Voice voice) {
+  for (Channel& channel : channels_) {
+    if (channel.voice == voice)
+      return &channel;
+  }
+  return nullptr;
+}
+
+AudioThread::Channel* AudioThread::Pick(SoundPriority priority) {
+  Channel* victim = nullptr;
+  for (Channel& channel : channels_) {
+    if (!channel.voice || !channel.sound.IsPlaying())
+      return &channel;
+    if (!victim || channel.priority < victim->priority ||
+        (channel.priority == victim->priority &&
+         channel.started < victim->started)) {
+      victim = &channel;
+    }
+  }
+  return victim->priority <= priority ? victim : nullptr;
+}
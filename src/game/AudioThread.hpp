@@ -0,0 +1,114 @@
+#ifndef GAME_AUDIO_THREAD_HPP
+#define GAME_AUDIO_THREAD_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <smk/Sound.hpp>
+#include <smk/SoundBuffer.hpp>
+#include <thread>
+#include "game/SpscRing.hpp"
+
+enum class SoundPriority { Low, Normal, High, Music };
+
+// Every sound of the game plays on one of the channels of the audio thread.
+// The game only sends commands: they go through lock-free queues to that
+// thread, which owns the smk::Sound and runs the fades. A new sound takes a
+// finished channel, else the oldest channel of the lowest priority, if it isn't
+// more important than the new sound. Otherwise the sound is dropped.
+//
+// This is not a software mixer: each channel is an OpenAL source, and OpenAL
+// mixes them. smk::SoundBuffer decodes the files into OpenAL buffers and gives
+// no access to the samples.
+class AudioThread {
+ public:
+  // Names a sound once played. Commands to a sound that ended are ignored.
+  using Voice = uint32_t;
+
+  // The commands of one thread. Never blocks nor locks. Commands sent while
+  // the queue is full are dropped. From one thread at a time: the calls of
+  // different threads must be ordered, as the phases of a level step are.
+  class Queue {
+   public:
+    Voice Play(const smk::SoundBuffer& buffer,
+               SoundPriority priority = SoundPriority::Normal,
+               float volume = 1.f,
+               bool loop = false);
+    void Stop(Voice voice);
+    void SetVolume(Voice voice, float volume);
+    // Reach |volume| in |seconds|. The sound stops once faded out to 0.
+    void Fade(Voice voice, float volume, float seconds);
+
+   private:
+    friend class AudioThread;
+    enum class Type { Play, Stop, Volume, Fade };
+    struct Command {
+      Type type;
+      Voice voice;
+      const smk::SoundBuffer* buffer = nullptr;
+      SoundPriority priority = SoundPriority::Normal;
+      float volume = 1.f;
+      float seconds = 0.f;
+      bool loop = false;
+    };
+
+    explicit Queue(AudioThread& audio) : audio_(audio) {}
+    void Push(const Command& command);
+
+    AudioThread& audio_;
+    SpscRing<Command, 256> ring_;  // Popped by the audio thread.
+  };
+
+  AudioThread();
+  // Stop every sound.
+  ~AudioThread();
+  AudioThread(const AudioThread&) = delete;
+  AudioThread& operator=(const AudioThread&) = delete;
+
+  Queue& level() { return level_; }  // From the thread stepping the level.
+  Queue& music() { return music_; }  // From the main loop.
+
+  // Where there are no threads, runs the commands. Call once per frame.
+  void Step();
+
+  int dropped() const { return dropped_; }
+
+ private:
+  struct Channel {
+    smk::Sound sound;
+    Voice voice = 0;  // 0 when free.
+    SoundPriority priority = SoundPriority::Low;
+    uint64_t started = 0;
+    float volume = 1.f;
+    float target = 1.f;
+    float speed = 0.f;  // Toward |target|, per second.
+    bool fading = false;
+  };
+
+  void Work();
+  void Update();
+  void Run(const Queue::Command& command);
+  Channel* Find(Voice voice);
+  Channel* Pick(SoundPriority priority);
+
+  std::atomic<Voice> last_voice_{0};
+  std::atomic<int> dropped_{0};
+  Queue level_{*this};
+  Queue music_{*this};
+
+  // Only used by the audio thread.
+  static constexpr int kChannels = 32;
+  std::array<Channel, kChannels> channels_;
+  uint64_t plays_ = 0;
+  std::chrono::steady_clock::time_point time_;
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool quit_ = false;
+  std::thread thread_;
+};
+
+#endif /* GAME_AUDIO_THREAD_HPP */
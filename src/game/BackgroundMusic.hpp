@@ -3,22 +3,20 @@
 
 #include <string>
 
-#include <smk/Sound.hpp>
 #include <smk/SoundBuffer.hpp>
+#include "game/AudioThread.hpp"
 #include "game/Resource.hpp"
 
+// The music loop. Changing it crossfades, on the audio thread.
 class BackgroundMusic {
  public:
-  void Start();
+  explicit BackgroundMusic(AudioThread::Queue& queue) : queue_(queue) {}
   void SetSound(const smk::SoundBuffer& buffer);
-  void Step();
 
  private:
-  const smk::SoundBuffer* foreground_sound_buffer_;
-  smk::Sound foreground_sound_;
-  smk::Sound background_sound_;
-
-  float time_ = 1.f;
+  AudioThread::Queue& queue_;
+  const smk::SoundBuffer* buffer_ = nullptr;
+  AudioThread::Voice voice_ = 0;
 };
 
 #endif /* GAME_BACKGROUND_MUSIC_HPP */
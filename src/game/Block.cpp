@@ -1,16 +1,20 @@
 #include "game/Block.hpp"
 #include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
 #include <smk/Window.hpp>
 
+namespace {
+const SpriteTemplate kBlock1(img_block1);
+const SpriteTemplate kBlock2(img_block2);
+const SpriteTemplate kBlock3(img_block3);
+}  // namespace
+
 Block::Block(int x, int y, int width, int height) {
   drawable = true;
-  sprite = smk::Sprite(img_block1);
-  sprite.SetPosition(x, y);
   geometry.left = x;
   geometry.top = y;
   geometry.right = x + width - 1;
   geometry.bottom = y + height - 1;
-  sprite.SetScale(1, 1);
   if (width == 32 and height == 32) {
     tiled = false;
   } else if (width % 32 == 0 and height % 32 == 0) {
@@ -19,7 +23,6 @@ Block::Block(int x, int y, int width, int height) {
     ytile = height / 32;
   } else {
     tiled = false;
-    sprite.SetScale(float(width - 1) / 31.0, float(height - 1) / 31.0);
   }
 }
 
@@ -29,31 +32,26 @@ Block::Block(int x, int y, int width, int height, bool) {
   geometry.top = y;
   geometry.right = x + width - 1;
   geometry.bottom = y + height - 1;
-  sprite.SetScale(1, 1);
 }
 
-void Block::Draw(smk::Window& window) {
+void Block::Draw(DrawList& target) {
   if (!drawable)
     return;
 
-  int i = 0;
-  if (!tiled)
-    window.Draw(sprite);
-
-  smk::Sprite sprites[] = {
-      smk::Sprite(img_block1),
-      smk::Sprite(img_block2),
-      smk::Sprite(img_block3),
-      smk::Sprite(img_block3),
-  };
-
   int x = geometry.left;
   int y = geometry.top;
+  if (!tiled) {
+    auto sprite = kBlock1.At(x, y);
+    sprite.SetScale((geometry.right - geometry.left) / 31.f,
+                    (geometry.bottom - geometry.top) / 31.f);
+    target.Draw(sprite);
+  }
+
+  const SpriteTemplate* tiles[] = {&kBlock1, &kBlock2, &kBlock3, &kBlock3};
+  int i = 0;
   for (int a = 0; a < xtile; a++) {
     for (int b = 0; b < ytile; b++) {
-      auto& sprite = sprites[i % 4];
-      sprite.SetPosition(x + 32 * a, y + 32 * b);
-      window.Draw(sprite);
+      target.Draw(tiles[i % 4]->At(x + 32 * a, y + 32 * b));
       ++i;
     }
   }
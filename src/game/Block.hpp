@@ -1,8 +1,8 @@
 #ifndef GAME_BLOCK_HPP
 #define GAME_BLOCK_HPP
 
+#include "game/DrawList.hpp"
 #include "game/Forme.hpp"
-#include <smk/Sprite.hpp>
 
 namespace smk {
 class Window;
@@ -14,14 +14,16 @@ class Block {
   Block(int x, int y, int width, int height, bool Drawable);
   virtual ~Block() = default;
   Rectangle geometry;
-  smk::Sprite sprite;
   int xtile = 0;
   int ytile = 0;
   bool tiled;
   bool drawable;
-  virtual void Draw(smk::Window& window);
+  virtual void Draw(DrawList& target);
 
+  Block(const Block&) = default;
   Block(Block&&) = default;
+  Block& operator=(const Block&) = default;
+  Block& operator=(Block&&) = default;
 };
 
 #endif /* GAME_BLOCK_HPP */
@@ -0,0 +1,124 @@
+#include "game/BoxBatch.hpp"
+#include <algorithm>
+
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(__EMSCRIPTEN__)
+#define BOX_KERNEL_X86
+#include <immintrin.h>
+#endif
+
+void BoxBatch::Clear() {
+  left_.clear();
+  top_.clear();
+  right_.clear();
+  bottom_.clear();
+}
+
+void BoxBatch::Add(const Rectangle& r) {
+  left_.push_back(std::min(r.left, r.right));
+  right_.push_back(std::max(r.left, r.right));
+  top_.push_back(std::min(r.top, r.bottom));
+  bottom_.push_back(std::max(r.top, r.bottom));
+}
+
+bool BoxBatch::AnyCollision(const Rectangle& r, int begin, int end) const {
+  if (begin >= end)
+    return false;
+  // Chosen once, at the first call.
+  static const BoxKernel kernel = GetBoxKernel();
+  Rectangle query(std::min(r.left, r.right), std::max(r.left, r.right),
+                  std::max(r.top, r.bottom), std::min(r.top, r.bottom));
+  return kernel(Input(begin, end), query);
+}
+
+BoxKernelInput BoxBatch::Input(int begin, int end) const {
+  return {left_.data() + begin, top_.data() + begin, right_.data() + begin,
+          bottom_.data() + begin, end - begin};
+}
+
+namespace {
+
+// Two normalized boxes collide when their intervals overlap on both axis. This
+// is what IsCrossing computes with its three IsBetween.
+inline __attribute__((always_inline)) bool AnyCollisionScalar(
+    const BoxKernelInput& b,
+    const Rectangle& q,
+    int i) {
+  for (; i < b.size; ++i) {
+    if (q.left <= b.right[i] && b.left[i] <= q.right &&  //
+        q.top <= b.bottom[i] && b.top[i] <= q.bottom) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool KernelScalar(const BoxKernelInput& b, const Rectangle& q) {
+  return AnyCollisionScalar(b, q, 0);
+}
+
+#ifdef BOX_KERNEL_X86
+
+__attribute__((target("sse2"))) bool KernelSSE(const BoxKernelInput& b,
+                                               const Rectangle& q) {
+  const __m128 q_left = _mm_set1_ps(q.left);
+  const __m128 q_top = _mm_set1_ps(q.top);
+  const __m128 q_right = _mm_set1_ps(q.right);
+  const __m128 q_bottom = _mm_set1_ps(q.bottom);
+  int i = 0;
+  for (; i + 4 <= b.size; i += 4) {
+    __m128 x = _mm_and_ps(_mm_cmple_ps(q_left, _mm_loadu_ps(b.right + i)),
+                          _mm_cmple_ps(_mm_loadu_ps(b.left + i), q_right));
+    __m128 y = _mm_and_ps(_mm_cmple_ps(q_top, _mm_loadu_ps(b.bottom + i)),
+                          _mm_cmple_ps(_mm_loadu_ps(b.top + i), q_bottom));
+    if (_mm_movemask_ps(_mm_and_ps(x, y)))
+      return true;
+  }
+  return AnyCollisionScalar(b, q, i);
+}
+
+__attribute__((target("avx2"))) bool KernelAVX2(const BoxKernelInput& b,
+                                                const Rectangle& q) {
+  const __m256 q_left = _mm256_set1_ps(q.left);
+  const __m256 q_top = _mm256_set1_ps(q.top);
+  const __m256 q_right = _mm256_set1_ps(q.right);
+  const __m256 q_bottom = _mm256_set1_ps(q.bottom);
+  int i = 0;
+  for (; i + 8 <= b.size; i += 8) {
+    __m256 x = _mm256_and_ps(
+        _mm256_cmp_ps(q_left, _mm256_loadu_ps(b.right + i), _CMP_LE_OQ),
+        _mm256_cmp_ps(_mm256_loadu_ps(b.left + i), q_right, _CMP_LE_OQ));
+    __m256 y = _mm256_and_ps(
+        _mm256_cmp_ps(q_top, _mm256_loadu_ps(b.bottom + i), _CMP_LE_OQ),
+        _mm256_cmp_ps(_mm256_loadu_ps(b.top + i), q_bottom, _CMP_LE_OQ));
+    if (_mm256_movemask_ps(_mm256_and_ps(x, y)))
+      return true;
+  }
+  return AnyCollisionScalar(b, q, i);
+}
+
+#endif  // BOX_KERNEL_X86
+
+}  // namespace
+
+BoxKernel GetBoxKernel(BoxKernelIsa isa) {
+  switch (isa) {
+    case BoxKernelIsa::Scalar:
+      return &KernelScalar;
+#ifdef BOX_KERNEL_X86
+    case BoxKernelIsa::SSE:
+      return __builtin_cpu_supports("sse2") ? &KernelSSE : nullptr;
+    case BoxKernelIsa::AVX2:
+      return __builtin_cpu_supports("avx2") ? &KernelAVX2 : nullptr;
+#endif
+    default:
+      return nullptr;
+  }
+}
+
+BoxKernel GetBoxKernel() {
+  for (BoxKernelIsa isa : {BoxKernelIsa::AVX2, BoxKernelIsa::SSE}) {
+    if (BoxKernel kernel = GetBoxKernel(isa))
+      return kernel;
+  }
+  return GetBoxKernel(BoxKernelIsa::Scalar);
+}
@@ -0,0 +1,56 @@
+#ifndef GAME_BOX_BATCH_HPP
+#define GAME_BOX_BATCH_HPP
+
+#include <vector>
+#include "game/Forme.hpp"
+
+// A range of normalized rectangles, as a structure of arrays.
+struct BoxKernelInput {
+  const float* left;
+  const float* top;
+  const float* right;
+  const float* bottom;
+  int size;
+};
+
+// Returns whether the normalized |query| collides with one of the |boxes|.
+using BoxKernel = bool (*)(const BoxKernelInput& boxes, const Rectangle& query);
+
+enum class BoxKernelIsa {
+  Scalar,
+  SSE,
+  AVX2,
+};
+
+// Returns nullptr when the compiler or the CPU doesn't support |isa|.
+BoxKernel GetBoxKernel(BoxKernelIsa isa);
+
+// The best kernel supported by the CPU.
+BoxKernel GetBoxKernel();
+
+// Rectangles stored as a structure of arrays, normalized so that
+// left <= right and top <= bottom. A query box is tested against 4 (SSE) or 8
+// (AVX2) of them at once.
+class BoxBatch {
+ public:
+  void Clear();
+  void Add(const Rectangle& r);
+  int size() const { return left_.size(); }
+
+  // Same result as testing IsCollision(r, rectangle) against the rectangles
+  // [begin, end).
+  bool AnyCollision(const Rectangle& r, int begin, int end) const;
+  bool AnyCollision(const Rectangle& r) const {
+    return AnyCollision(r, 0, size());
+  }
+
+  BoxKernelInput Input(int begin, int end) const;
+
+ private:
+  std::vector<float> left_;
+  std::vector<float> top_;
+  std::vector<float> right_;
+  std::vector<float> bottom_;
+};
+
+#endif /* GAME_BOX_BATCH_HPP */
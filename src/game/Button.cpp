@@ -1,6 +1,19 @@
 #include "game/Button.hpp"
-#include <smk/Sprite.hpp>
 #include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
+
+namespace {
+void Center(smk::Sprite& sprite) {
+  sprite.SetCenter(8, 8);
+}
+// Indexed by the number of times the button was pressed.
+const SpriteTemplate kButtons[] = {
+    SpriteTemplate(img_button[0], Center),
+    SpriteTemplate(img_button[1], Center),
+    SpriteTemplate(img_button[2], Center),
+    SpriteTemplate(img_button[3], Center),
+};
+}  // namespace
 
 Button::Button(int x, int y, int n) {
   nb_pressed = 0;
@@ -13,9 +26,6 @@ Button::Button(int x, int y, int n) {
   nb_pressed_required = n;
 }
 
-void Button::Draw(smk::Window& window) {
-  smk::Sprite sprite(img_button[nb_pressed]);
-  sprite.SetCenter(8, 8);
-  sprite.SetPosition(geometry.left + 8, geometry.top + 8);
-  window.Draw(sprite);
+void Button::Draw(DrawList& target) {
+  target.Draw(kButtons[nb_pressed].At(geometry.left + 8, geometry.top + 8));
 }
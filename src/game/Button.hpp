@@ -2,7 +2,7 @@
 #define GAME_BUTTON_HPP
 
 #include "game/Forme.hpp"
-#include <smk/Window.hpp>
+#include "game/DrawList.hpp"
 
 class Button {
  public:
@@ -14,7 +14,7 @@ class Button {
 
   Button(int x, int y, int n);
 
-  void Draw(smk::Window& window);
+  void Draw(DrawList& target);
 };
 
 #endif /* GAME_BUTTON_HPP */
@@ -1,20 +1,21 @@
 #include "Cloner.hpp"
 #include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
 #include <smk/Window.hpp>
 
+namespace {
+const SpriteTemplate kCloner(img_cloneur);
+}  // namespace
+
 Cloner::Cloner(int Xstart, int Ystart, int Xend, int Yend) {
   xstart = Xstart;
   ystart = Ystart;
   xend = Xend;
   yend = Yend;
-  sprite = smk::Sprite(img_cloneur);
-  sprite.SetPosition(xstart, ystart);
   enable = true;
 }
 
-void Cloner::Draw(smk::Window& window) {
-  sprite.SetPosition(xstart, ystart);
-  window.Draw(sprite);
-  sprite.SetPosition(xend, yend);
-  window.Draw(sprite);
+void Cloner::Draw(DrawList& target) {
+  target.Draw(kCloner.At(xstart, ystart));
+  target.Draw(kCloner.At(xend, yend));
 }
@@ -1,7 +1,7 @@
 #ifndef GAME_CLONER_HPP
 #define GAME_CLONER_HPP
 
-#include <smk/Sprite.hpp>
+#include "game/DrawList.hpp"
 
 namespace smk {
 class Window;
@@ -11,9 +11,8 @@ class Cloner {
  public:
   int xstart, ystart, xend, yend;
   bool enable;
-  smk::Sprite sprite;
   Cloner(int Xstart, int Ystart, int Xend, int Yend);
-  void Draw(smk::Window& window);
+  void Draw(DrawList& target);
 };
 
 #endif /* GAME_CLONER_HPP */
@@ -1,44 +1,42 @@
 #include "game/Creeper.hpp"
 #include "game/Resource.hpp"
-#include <cstdlib>
+#include "game/SpriteTemplate.hpp"
 #include <smk/Window.hpp>
 
-Creeper::Creeper(int X, int Y) {
+namespace {
+const SpriteTemplate kCreeper(img_creeper, [](smk::Sprite& sprite) {
+  sprite.SetCenter(8, 16);
+});
+}  // namespace
+
+Creeper::Creeper(int X, int Y, Random& random) {
   x = X;
   y = Y;
-  sprite = smk::Sprite(img_creeper);
   t = 0;
   mode = 0;
-  t = rand() % 10;
-  sprite.SetCenter(8, 16);
+  t = random.Rand() % 10;
   geometry = Rectangle(x - 9, x + 9, y - 15, y - 15);
   xspeed = -2;
+  yspeed = 0;
 }
-void Creeper::Draw(smk::Window& window) {
-  sprite.SetPosition(x, y);
-
+void Creeper::Draw(DrawList& target) {
   if (mode == 0) {
     int position[] = {-2, -1, 0, 1, 2, 1, 0, -1};
-    sprite.SetPosition(x + position[(t / 2) % 8], y);
-    window.Draw(sprite);
+    target.Draw(kCreeper.At(x + position[(t / 2) % 8], y));
   } else {
+    auto sprite = kCreeper.At(x, y);
     switch (t % 2) {
       case 0:
         sprite.SetColor(glm::vec4(255, 255, 255, 100));
-        sprite.SetScale(1, 1);
-        window.Draw(sprite);
+        target.Draw(sprite);
 
         sprite.SetColor(glm::vec4(255, 255, 255, 150));
         sprite.SetScale(1.3, 1.3);
-        window.Draw(sprite);
-
-        sprite.SetScale(1, 1);
-        sprite.SetColor(glm::vec4(255, 255, 255, 255));
-
+        target.Draw(sprite);
         break;
 
       default:
-        window.Draw(sprite);
+        target.Draw(sprite);
         break;
     }
   }
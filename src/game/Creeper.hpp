@@ -1,8 +1,9 @@
 #ifndef GAME_CREEPER_HPP
 #define GAME_CREEPER_HPP
 
+#include "game/DrawList.hpp"
 #include "game/Forme.hpp"
-#include <smk/Sprite.hpp>
+#include "game/Random.hpp"
 
 namespace smk {
 class Window;
@@ -12,12 +13,11 @@ class Creeper {
  public:
   float x, y, xspeed, yspeed;
   int mode;
-  smk::Sprite sprite;
   Rectangle geometry;
   int t;
 
-  Creeper(int x, int y);
-  void Draw(smk::Window& window);
+  Creeper(int x, int y, Random& random);
+  void Draw(DrawList& target);
   void UpdateGeometry();
 };
 
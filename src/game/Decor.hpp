@@ -1,7 +1,8 @@
 #ifndef GAME_DECOR_HPP
 #define GAME_DECOR_HPP
 
-#include <smk/Sprite.hpp>
+#include "game/DrawList.hpp"
+#include "game/SpriteTemplate.hpp"
 
 namespace smk {
 class Window;
@@ -9,10 +10,12 @@ class Window;
 
 class Decor {
  public:
-  smk::Sprite sprite;
+  const SpriteTemplate* kind = nullptr;
+  float x = 0.f;
+  float y = 0.f;
 
   Decor(int X, int Y, int IMG);
-  void Draw(smk::Window& window);
+  void Draw(DrawList& target);
 };
 
 #endif /* GAME_DECOR_HPP */
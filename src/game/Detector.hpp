@@ -6,7 +6,7 @@
 class Detector {
  public:
   Rectangle geometry;
-  bool detected;
+  bool detected = false;
   Detector(int x1, int y1, int x2, int y2);
 };
 
@@ -0,0 +1,42 @@
+#include "game/DrawList.hpp"
+
+void DrawList::SetView(const smk::View& view) {
+  view_ = view;
+  commands_.emplace_back(view);
+}
+
+void DrawList::Draw(const smk::Transformable& transformable) {
+  commands_.emplace_back(transformable);
+}
+
+void DrawList::Draw(const smk::Text& text) {
+  commands_.emplace_back(text);
+}
+
+void DrawList::Call(Function command) {
+  commands_.emplace_back(std::move(command));
+}
+
+void DrawList::Execute(smk::RenderTarget& target) const {
+  for (const Command& command : commands_) {
+    if (auto* view = std::get_if<smk::View>(&command))
+      target.SetView(*view);
+    else if (auto* transformable = std::get_if<smk::Transformable>(&command))
+      target.Draw(*transformable);
+    else if (auto* text = std::get_if<smk::Text>(&command))
+      target.Draw(*text);
+    else
+      std::get<Function>(command)(target);
+  }
+}
+
+int DrawList::draw_calls() const {
+  int draw_calls = 0;
+  for (const Command& command : commands_)
+    draw_calls += !std::holds_alternative<smk::View>(command);
+  return draw_calls;
+}
+
+void DrawList::Clear() {
+  commands_.clear();
+}
@@ -0,0 +1,45 @@
+#ifndef GAME_DRAW_LIST_HPP
+#define GAME_DRAW_LIST_HPP
+
+#include <functional>
+#include <smk/RenderTarget.hpp>
+#include <smk/Text.hpp>
+#include <smk/Transformable.hpp>
+#include <smk/View.hpp>
+#include <variant>
+#include <vector>
+
+// The draw calls of a frame, recorded while walking the level and executed
+// afterward on the thread owning the GL context. Drawables are copied, so the
+// level is free to change once they are recorded.
+class DrawList {
+ public:
+  using Function = std::function<void(smk::RenderTarget&)>;
+
+  void SetView(const smk::View& view);
+  // The last view set.
+  const smk::View& GetView() const { return view_; }
+
+  void Draw(const smk::Transformable& transformable);
+  void Draw(const smk::Text& text);
+
+  // For the draw calls not expressed as a drawable. |command| must not refer
+  // to the level.
+  void Call(Function command);
+
+  void Execute(smk::RenderTarget& target) const;
+
+  // The commands drawing something, as opposed to setting the view.
+  int draw_calls() const;
+
+  // Remove the commands. Their memory is reused by the next frame.
+  void Clear();
+
+ private:
+  using Command =
+      std::variant<smk::View, smk::Transformable, smk::Text, Function>;
+  std::vector<Command> commands_;
+  smk::View view_;
+};
+
+#endif /* GAME_DRAW_LIST_HPP */
@@ -1,7 +1,25 @@
 #include "game/Electricity.hpp"
+#include <cmath>
+#include <cstdint>
 #include "game/Resource.hpp"
-#include <smk/Sprite.hpp>
-#include <smk/Shape.hpp>
+#include "game/SpriteTemplate.hpp"
+
+namespace {
+
+const SpriteTemplate kSupport(img_electricitySupport);
+
+// Hash of (a, b, c), in [0, 1).
+float Noise(uint32_t a, uint32_t b, uint32_t c) {
+  uint32_t h = a * 0x9E3779B1u ^ b * 0x85EBCA77u ^ c * 0xC2B2AE3Du;
+  h ^= h >> 15;
+  h *= 0x2C1B3C6Du;
+  h ^= h >> 12;
+  h *= 0x297A2D39u;
+  h ^= h >> 15;
+  return (h >> 8) * (1.f / (1 << 24));
+}
+
+}  // namespace
 
 Electricity::Electricity(int X1,
                          int Y1,
@@ -10,8 +28,7 @@ Electricity::Electricity(int X1,
                          float Ratio,
                          int Periode,
                          int Offset) {
-  sound = smk::Sound(SB_electricity);
-  sound.SetLoop(true);
+  sound = SoundSource(SB_electricity, /*loop=*/true);
   x1 = X1;
   y1 = Y1;
   x2 = X2;
@@ -22,6 +39,7 @@ Electricity::Electricity(int X1,
 }
 
 void Electricity::Step(int time) {
+  time_ = time;
   if (((time + offset) % (periode)) < ratio * periode) {
     if (!is_active_) {
       sound.Play();
@@ -35,39 +53,43 @@ void Electricity::Step(int time) {
   }
 }
 
-void Electricity::Draw(smk::Window& window) {
-  auto sprite = smk::Sprite(img_electricitySupport);
-  sprite.SetPosition(x1 - 8, y1 - 8);
-  window.Draw(sprite);
-  sprite.SetPosition(x2 - 8, y2 - 8);
-  window.Draw(sprite);
+// 3 arcs, each a walk of 9px steps toward (x2, y2), deviating randomly by up
+// to ~50 degrees.
+void Electricity::UpdateArcs() {
+  arcs_time_ = time_;
+  arcs_.clear();
+
+  uint32_t seed = uint32_t(x1) * 31 + uint32_t(y1) * 17 + uint32_t(time_);
+  int max_steps = (abs(x2 - x1) + abs(y2 - y1)) / 3 + 16;
+  for (int i = 0; i < 3; ++i) {
+    glm::vec2 position(x1, y1);
+    glm::vec2 target(x2, y2);
+    for (int step = 0; step < max_steps; ++step) {
+      glm::vec2 diff = target - position;
+      if (std::abs(diff.x) + std::abs(diff.y) <= 5)
+        break;
+      float angle = atan2(diff.y, diff.x);
+      angle += float(int(Noise(seed, i, step) * 10) - 20) * 0.2;
+      glm::vec2 next = position - 9.f * glm::vec2(cos(angle), sin(angle));
+      arcs_.push_back(position);
+      arcs_.push_back(next);
+      position = next;
+    }
+  }
+}
+
+void Electricity::Draw(DrawList& target, LineBatch& glow, LineBatch& core) {
+  target.Draw(kSupport.At(x1 - 8, y1 - 8));
+  target.Draw(kSupport.At(x2 - 8, y2 - 8));
 
   if (!is_active_)
     return;
 
-  for (int i = 0; i < 3; ++i) {
-    int x = x1;
-    int y = y1;
-    int xfinal = x2;
-    int yfinal = y2;
-    while (abs(x - xfinal) + abs(y - yfinal) > 5) {
-      float angle = atan2(yfinal - y, xfinal - x);
-      angle += float(rand() % 10 - 20) * 0.2;
-      int xx = x - 9 * cos(angle);
-      int yy = y - 9 * sin(angle);
-      for (int r = 3; r <= 10; r += 2) {
-        auto line1 = smk::Shape::Line({x, y}, {xx, yy}, r);
-        line1.SetColor(glm::vec4(242, 224, 58, 20 - r) / 255.f);
-        line1.SetBlendMode(smk::BlendMode::Add);
-        window.Draw(line1);
-      }
-
-      auto line = smk::Shape::Line({x, y}, {xx, yy}, 1);
-      line.SetColor(glm::vec4(252, 234, 68, 255) / 255.f);
-      x = xx;
-      y = yy;
+  if (arcs_time_ != time_)
+    UpdateArcs();
 
-      window.Draw(line);
-    }
+  for (size_t i = 0; i < arcs_.size(); i += 2) {
+    glow.Add(arcs_[i], arcs_[i + 1], 12);
+    core.Add(arcs_[i], arcs_[i + 1], 1);
   }
 }
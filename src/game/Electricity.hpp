@@ -1,9 +1,11 @@
 #ifndef GAME_ELECTRICITY_HPP
 #define GAME_ELECTRICITY_HPP
 
-#include <smk/Window.hpp>
-#include <smk/Sound.hpp>
+#include "game/DrawList.hpp"
+#include <vector>
+#include "game/LineBatch.hpp"
 #include "game/Resource.hpp"
+#include "game/SoundSource.hpp"
 
 class Electricity {
  public:
@@ -11,7 +13,7 @@ class Electricity {
   float ratio;
   int periode;
   int offset;
-  smk::Sound sound;
+  SoundSource sound;
   Electricity(int X1,
               int Y1,
               int X2,
@@ -20,10 +22,18 @@ class Electricity {
               int Periode,
               int Offset);
   void Step(int time);
-  void Draw(smk::Window&);
-  bool is_active() { return is_active_; }
+  // The arcs are appended to |glow| and |core|, drawn later by the caller.
+  void Draw(DrawList& target, LineBatch& glow, LineBatch& core);
+  bool is_active() const { return is_active_; }
  private:
+  void UpdateArcs();
+
   bool is_active_ = false;
+  int time_ = 0;
+
+  // The arcs depend only on |time_|. They are rebuilt once per tick.
+  int arcs_time_ = -1;
+  std::vector<glm::vec2> arcs_;  // Segments: [a0, b0, a1, b1, ...]
 };
 
 #endif /* GAME_ELECTRICITY_HPP */
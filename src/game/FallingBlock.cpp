@@ -1,6 +1,11 @@
 #include "game/FallingBlock.hpp"
 #include <smk/Window.hpp>
 #include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
+
+namespace {
+const SpriteTemplate kFallingBlock(img_block2);
+}  // namespace
 
 FallingBlock::FallingBlock(float X, float Y) {
   x = X;
@@ -10,8 +15,6 @@ FallingBlock::FallingBlock(float X, float Y) {
   geometry.top = Y;
   geometry.right = X + 31;
   geometry.bottom = Y + 31;
-  sprite = smk::Sprite(img_block2);
-  sprite.SetPosition(X, Y);
   etape = 0;
 }
 
@@ -25,14 +28,10 @@ void FallingBlock::UpdateGeometry() {
   geometry.top = y;
   geometry.right = x + 31;
   geometry.bottom = y + 31;
-  sprite.SetPosition(x, y);
 }
-void FallingBlock::Draw(smk::Window& window) {
-  if (etape != 0 and etape <= 15) {
-    sprite.Move(SinusSintoide(etape), 0);
-    window.Draw(sprite);
-    sprite.Move(-SinusSintoide(etape), 0);
-  } else {
-    window.Draw(sprite);
-  }
+void FallingBlock::Draw(DrawList& target) {
+  if (etape != 0 and etape <= 15)
+    target.Draw(kFallingBlock.At(x + SinusSintoide(etape), y));
+  else
+    target.Draw(kFallingBlock.At(x, y));
 }
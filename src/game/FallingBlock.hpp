@@ -1,8 +1,8 @@
 #ifndef GAME_FALLING_BLOCK_HPP
 #define GAME_FALLING_BLOCK_HPP
 
+#include "game/DrawList.hpp"
 #include "game/Forme.hpp"
-#include <smk/Sprite.hpp>
 
 namespace smk {
 class Window;
@@ -12,9 +12,8 @@ class FallingBlock {
  public:
   FallingBlock(float X, float Y);
   Rectangle geometry;
-  smk::Sprite sprite;
   void UpdateGeometry();
-  void Draw(smk::Window& window);
+  void Draw(DrawList& target);
   float x, y;
   float yspeed;
   int etape;
@@ -0,0 +1,52 @@
+#include "game/FileWatcher.hpp"
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#define FILE_WATCHER_INOTIFY
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+FileWatcher::FileWatcher(const std::string& path) {
+  size_t separator = path.find_last_of("/\\");
+  std::string directory =
+      separator == std::string::npos ? "." : path.substr(0, separator);
+  name_ = path.substr(separator + 1);
+
+#if defined(FILE_WATCHER_INOTIFY)
+  fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (fd_ < 0)
+    return;
+  if (inotify_add_watch(fd_, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) <
+      0) {
+    close(fd_);
+    fd_ = -1;
+  }
+#endif
+}
+
+FileWatcher::~FileWatcher() {
+#if defined(FILE_WATCHER_INOTIFY)
+  if (fd_ >= 0)
+    close(fd_);
+#endif
+}
+
+bool FileWatcher::Changed() {
+  bool changed = false;
+#if defined(FILE_WATCHER_INOTIFY)
+  if (fd_ < 0)
+    return false;
+
+  alignas(inotify_event) char buffer[4096];
+  ssize_t size;
+  while ((size = read(fd_, buffer, sizeof(buffer))) > 0) {
+    for (char* it = buffer; it < buffer + size;) {
+      auto* event = reinterpret_cast<inotify_event*>(it);
+      if (event->len && name_ == event->name)
+        changed = true;
+      it += sizeof(inotify_event) + event->len;
+    }
+  }
+#endif
+  return changed;
+}
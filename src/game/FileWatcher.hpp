@@ -0,0 +1,24 @@
+#ifndef GAME_FILE_WATCHER_HPP
+#define GAME_FILE_WATCHER_HPP
+
+#include <string>
+
+// Tells when a file is written. Its directory is watched with inotify, so that
+// editors saving through a temporary file and a rename are seen too. Never
+// reports anything where inotify isn't available.
+class FileWatcher {
+ public:
+  explicit FileWatcher(const std::string& path);
+  ~FileWatcher();
+  FileWatcher(const FileWatcher&) = delete;
+  FileWatcher& operator=(const FileWatcher&) = delete;
+
+  // Whether the file was written since the last call. Never blocks.
+  bool Changed();
+
+ private:
+  std::string name_;
+  int fd_ = -1;
+};
+
+#endif /* GAME_FILE_WATCHER_HPP */
@@ -0,0 +1,111 @@
+#include "game/FileWriter.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+void WriteAtomically(const std::string& path, const std::string& content) {
+  std::string temporary = path + ".tmp";
+  std::FILE* file = std::fopen(temporary.c_str(), "wb");
+  if (!file)
+    return;
+  bool written =
+      std::fwrite(content.data(), 1, content.size(), file) == content.size();
+  written &= std::fflush(file) == 0;
+#ifndef __EMSCRIPTEN__
+  written &= fsync(fileno(file)) == 0;
+#endif
+  written &= std::fclose(file) == 0;
+
+  if (!written || std::rename(temporary.c_str(), path.c_str())) {
+    std::cerr << "Can't write " << path << std::endl;
+    std::remove(temporary.c_str());
+  }
+}
+
+#ifdef __EMSCRIPTEN__
+// Copying the files to IndexedDB is slow. Once per burst of writes.
+const int kIdbfsDelay = 250;  // ms
+bool idbfs_sync_pending = false;
+void SyncIdbfs(void*) {
+  idbfs_sync_pending = false;
+  EM_ASM(FS.syncfs(false, function(err){console.log(err)});, 0);
+}
+#endif
+
+}  // namespace
+
+FileWriter::~FileWriter() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    quit_ = true;
+  }
+  wake_.notify_one();
+  if (thread_.joinable())
+    thread_.join();
+}
+
+#ifdef __EMSCRIPTEN__
+
+// No threads there. The file system is in memory, so writing is cheap.
+void FileWriter::Write(const std::string& path,
+                       std::string content,
+                       std::chrono::milliseconds) {
+  WriteAtomically(path, content);
+  if (idbfs_sync_pending)
+    return;
+  idbfs_sync_pending = true;
+  emscripten_async_call(SyncIdbfs, nullptr, kIdbfsDelay);
+}
+
+void FileWriter::Work() {}
+
+#else
+
+void FileWriter::Write(const std::string& path,
+                       std::string content,
+                       std::chrono::milliseconds debounce) {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    pending_[path] = {std::move(content),
+                      std::chrono::steady_clock::now() + debounce};
+  }
+  if (!thread_.joinable())
+    thread_ = std::thread(&FileWriter::Work, this);
+  wake_.notify_one();
+}
+
+void FileWriter::Work() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    wake_.wait(lock, [&] { return !pending_.empty() || quit_; });
+    if (pending_.empty())
+      return;
+
+    // Write() pushes the deadlines back. Everything is written on quit.
+    auto next = std::min_element(
+        pending_.begin(), pending_.end(), [](auto& a, auto& b) {
+          return a.second.deadline < b.second.deadline;
+        });
+    if (!quit_ && std::chrono::steady_clock::now() < next->second.deadline) {
+      wake_.wait_until(lock, next->second.deadline);
+      continue;
+    }
+
+    std::string path = next->first;
+    std::string content = std::move(next->second.content);
+    pending_.erase(next);
+    lock.unlock();
+    WriteAtomically(path, content);
+    lock.lock();
+  }
+}
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef GAME_FILE_WRITER_HPP
+#define GAME_FILE_WRITER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Writes files on a background thread, so that a frame never waits for the
+// disk. A file is written to a temporary file, then renamed over the old one:
+// a crash leaves either the old file or the new one, never a truncated one.
+class FileWriter {
+ public:
+  FileWriter() = default;
+  // Write what is still pending.
+  ~FileWriter();
+  FileWriter(const FileWriter&) = delete;
+  FileWriter& operator=(const FileWriter&) = delete;
+
+  // Never blocks. The file is written once no other call for the same |path|
+  // came for |debounce|, so that a burst of them is written once.
+  void Write(const std::string& path,
+             std::string content,
+             std::chrono::milliseconds debounce = {});
+
+ private:
+  void Work();
+
+  struct Pending {
+    std::string content;
+    std::chrono::steady_clock::time_point deadline;
+  };
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::map<std::string, Pending> pending_;
+  bool quit_ = false;
+  std::thread thread_;
+};
+
+#endif /* GAME_FILE_WRITER_HPP */
@@ -0,0 +1,65 @@
+#ifndef GAME_FIXED_HPP
+#define GAME_FIXED_HPP
+
+#include <cmath>
+#include <cstdint>
+
+// Signed 24.8 fixed point number.
+//
+// Used by the fixed point simulation mode (see Level::fixed_point): the objects
+// simulated with it get the same state on every build, whatever the compiler,
+// the optimization level or the floating point unit.
+//
+// Below 2^16, every value is exactly representable as a float, so the objects
+// can keep storing their position and speed in float.
+class Fixed {
+ public:
+  Fixed() = default;
+  Fixed(int v) : raw_(v * one) {}
+  Fixed(float v) : raw_(std::lround(double(v) * one)) {}
+  Fixed(double v) : raw_(std::lround(v * one)) {}
+
+  explicit operator float() const { return float(raw_) / one; }
+  explicit operator int() const { return raw_ / one; }  // Toward zero.
+
+  Fixed& operator+=(Fixed o) { raw_ += o.raw_; return *this; }
+  Fixed& operator-=(Fixed o) { raw_ -= o.raw_; return *this; }
+  Fixed& operator*=(Fixed o) { raw_ = Mul(raw_, o.raw_); return *this; }
+
+  friend Fixed operator+(Fixed a, Fixed b) { return a += b; }
+  friend Fixed operator-(Fixed a, Fixed b) { return a -= b; }
+  friend Fixed operator*(Fixed a, Fixed b) { return a *= b; }
+
+  // clang-format off
+  friend bool operator==(Fixed a, Fixed b) { return a.raw_ == b.raw_; }
+  friend bool operator!=(Fixed a, Fixed b) { return a.raw_ != b.raw_; }
+  friend bool operator< (Fixed a, Fixed b) { return a.raw_ <  b.raw_; }
+  friend bool operator<=(Fixed a, Fixed b) { return a.raw_ <= b.raw_; }
+  friend bool operator> (Fixed a, Fixed b) { return a.raw_ >  b.raw_; }
+  friend bool operator>=(Fixed a, Fixed b) { return a.raw_ >= b.raw_; }
+  // clang-format on
+
+  static Fixed FromRaw(int32_t raw) {
+    Fixed f;
+    f.raw_ = raw;
+    return f;
+  }
+  int32_t raw() const { return raw_; }
+
+ private:
+  static constexpr int32_t one = 256;
+
+  // Round to nearest, ties toward +infinity.
+  static int32_t Mul(int32_t a, int32_t b) {
+    return int32_t((int64_t(a) * b + one / 2) >> 8);
+  }
+
+  int32_t raw_ = 0;
+};
+
+// Table based trigonometry, for angles in degrees. Unlike std::sin, the result
+// doesn't depend on the C library.
+Fixed SinDegrees(int degrees);
+Fixed CosDegrees(int degrees);
+
+#endif /* GAME_FIXED_HPP */
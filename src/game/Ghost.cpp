@@ -0,0 +1,114 @@
+#include "game/Ghost.hpp"
+#include <cmath>
+#include <cstring>
+#include <smk/Sprite.hpp>
+#include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
+
+namespace {
+
+const char kMagic[4] = {'I', 'C', 'G', '1'};
+const float kQuantum = 4.f;  // Per pixel.
+
+void Translucent(smk::Sprite& sprite) {
+  sprite.SetColor({1.f, 1.f, 1.f, 0.35f});
+}
+const SpriteTemplate kGhostLeft(img_hero_left, Translucent);
+const SpriteTemplate kGhostRight(img_hero_right, Translucent);
+
+void WriteVarint(std::string& out, uint32_t value) {
+  while (value >= 0x80) {
+    out += char(value | 0x80);
+    value >>= 7;
+  }
+  out += char(value);
+}
+
+bool ReadVarint(std::istream& in, uint32_t& value) {
+  value = 0;
+  for (int shift = 0; shift < 35; shift += 7) {
+    int byte = in.get();
+    if (byte == EOF)
+      return false;
+    value |= uint32_t(byte & 0x7F) << shift;
+    if (!(byte & 0x80))
+      return true;
+  }
+  return false;
+}
+
+uint32_t ZigZag(int32_t value) {
+  return (uint32_t(value) << 1) ^ uint32_t(value >> 31);
+}
+
+int32_t UnZigZag(uint32_t value) {
+  return int32_t(value >> 1) ^ -int32_t(value & 1);
+}
+
+}  // namespace
+
+void GhostRecorder::Record(int tick, const GhostSample& sample) {
+  if (tick <= ticks_)
+    return;
+  ticks_ = tick;
+
+  int x = std::lround(sample.x * kQuantum);
+  int y = std::lround(sample.y * kQuantum);
+  WriteVarint(data_, ZigZag(x - x_) << 1 | sample.left);
+  WriteVarint(data_, ZigZag(y - y_));
+  x_ = x;
+  y_ = y;
+}
+
+std::string GhostRecorder::Encode() const {
+  std::string content(kMagic, sizeof(kMagic));
+  WriteVarint(content, ticks_);
+  return content + data_;
+}
+
+GhostReader::GhostReader(const std::string& path)
+    : file_(path, std::ios::binary) {
+  char magic[sizeof(kMagic)];
+  uint32_t ticks;
+  if (!file_.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, kMagic, sizeof(magic)) ||
+      !ReadVarint(file_, ticks)) {
+    return;
+  }
+  ticks_ = ticks;
+  start_ = file_.tellg();
+}
+
+void GhostReader::Rewind() {
+  file_.clear();
+  file_.seekg(start_);
+  tick_ = 0;
+  x_ = 0;
+  y_ = 0;
+}
+
+bool GhostReader::Seek(int tick) {
+  if (tick < 1 || tick > ticks_)
+    return false;
+  if (tick < tick_)
+    Rewind();
+
+  for (; tick_ < tick; ++tick_) {
+    uint32_t dx, dy;
+    if (!ReadVarint(file_, dx) || !ReadVarint(file_, dy)) {
+      ticks_ = tick_;  // Truncated.
+      return false;
+    }
+    left_ = dx & 1;
+    x_ += UnZigZag(dx >> 1);
+    y_ += UnZigZag(dy);
+  }
+  return true;
+}
+
+void GhostReader::Draw(DrawList& target, int tick) {
+  if (!Seek(tick))
+    return;
+  auto& ghost = left_ ? kGhostLeft : kGhostRight;
+  target.Draw(ghost.At(x_ / kQuantum, y_ / kQuantum));
+}
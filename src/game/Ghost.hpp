@@ -0,0 +1,62 @@
+#ifndef GAME_GHOST_HPP
+#define GAME_GHOST_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include "game/DrawList.hpp"
+
+// A best-run ghost: the selected hero of a previous run, drawn translucent
+// while the player plays. Only its track is stored, one sample per tick:
+//
+//   "ICG1" <ticks> then per tick: <zigzag(dx) << 1 | left> <zigzag(dy)>
+//
+// with varint numbers and positions in quarters of pixel, relative to the
+// previous tick. A tick takes 2 or 3 bytes.
+struct GhostSample {
+  float x = 0.f;
+  float y = 0.f;
+  bool left = false;
+};
+
+class GhostRecorder {
+ public:
+  // Call after every Step. Ticks already recorded are ignored, as when the
+  // level is paused by a text popup.
+  void Record(int tick, const GhostSample& sample);
+  int ticks() const { return ticks_; }
+  // The content of the ghost file.
+  std::string Encode() const;
+
+ private:
+  std::string data_;
+  int ticks_ = 0;
+  int x_ = 0;
+  int y_ = 0;
+};
+
+// Read from the disk while it is played: only the samples up to the current
+// tick are decoded.
+class GhostReader {
+ public:
+  explicit GhostReader(const std::string& path);
+  bool valid() const { return ticks_ > 0; }
+  int ticks() const { return ticks_; }
+
+  // Draw the ghost at |tick|. Nothing once its run is over.
+  void Draw(DrawList& target, int tick);
+
+ private:
+  bool Seek(int tick);
+  void Rewind();
+
+  std::ifstream file_;
+  std::streampos start_;
+  int ticks_ = 0;
+  int tick_ = 0;
+  int x_ = 0;
+  int y_ = 0;
+  bool left_ = false;
+};
+
+#endif /* GAME_GHOST_HPP */
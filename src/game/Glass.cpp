@@ -1,7 +1,12 @@
 #include "game/Glass.hpp"
 #include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
 #include <smk/Window.hpp>
 
+namespace {
+const SpriteTemplate kGlass(img_glass);
+}  // namespace
+
 Glass::Glass(int X, int Y) {
   x = X;
   y = Y;
@@ -11,8 +16,6 @@ Glass::Glass(int X, int Y) {
   geometry.top = Y;
   geometry.right = X + 31;
   geometry.bottom = Y + 31;
-  sprite = smk::Sprite(img_glass);
-  sprite.SetPosition(X, Y);
   height = 31;
   width = 31;
 }
@@ -21,10 +24,10 @@ void Glass::UpdateGeometry() {
   geometry.top = y;
   geometry.right = x + width;
   geometry.bottom = y + height;
-  sprite.SetPosition(x, y);
-  sprite.SetScale(width / 31, height / 31);
 }
 
-void Glass::Draw(smk::Window& window) {
-  window.Draw(sprite);
+void Glass::Draw(DrawList& target) {
+  auto sprite = kGlass.At(x, y);
+  sprite.SetScale(width / 31, height / 31);
+  target.Draw(sprite);
 }
@@ -1,7 +1,7 @@
 #ifndef GAME_GLASS_HPP
 #define GAME_GLASS_HPP
 
-#include <smk/Sprite.hpp>
+#include "game/DrawList.hpp"
 #include "game/Forme.hpp"
 
 namespace smk {
@@ -11,7 +11,6 @@ class Window;
 class Glass {
  public:
   Rectangle geometry;
-  smk::Sprite sprite;
   float x, y, xspeed, yspeed;
   float height;
   float width;
@@ -19,7 +18,7 @@ class Glass {
 
   Glass(int x, int y);
   void UpdateGeometry();
-  void Draw(smk::Window& window);
+  void Draw(DrawList& target);
 };
 
 #endif /* GAME_GLASS_HPP */
@@ -1,6 +1,12 @@
 #include "game/Hero.hpp"
 #include <smk/Window.hpp>
 #include <smk/Color.hpp>
+#include "game/SpriteTemplate.hpp"
+
+namespace {
+const SpriteTemplate kHeroLeft(img_hero_left);
+const SpriteTemplate kHeroRight(img_hero_right);
+}  // namespace
 
 //Hero::Hero() {
   //geometry.left = 0;
@@ -22,8 +28,6 @@ Hero::Hero(float X, float Y) {
   geometry.top = Y;
   geometry.right = X + 29;
   geometry.bottom = Y + 29;
-  sprite = smk::Sprite(img_hero_left);
-  sprite.SetPosition(X, Y);
   x = X;
   y = Y;
   xspeed = 0;
@@ -36,17 +40,16 @@ void Hero::SetPosition(float X, float Y) {
   geometry.top = Y;
   geometry.right = X + 29;
   geometry.bottom = Y + 29;
-  sprite.SetPosition(X, Y);
   x = X;
   y = Y;
 }
 
-void Hero::Draw(smk::Window& window, bool selected) {
+void Hero::Draw(DrawList& target, bool selected) {
   static const glm::vec4 colorNonSelected = {0.78, 0.78, 0.39, 1.f};
-  sprite.SetTexture(sens ? img_hero_left : img_hero_right);
+  auto sprite = (sens ? kHeroLeft : kHeroRight).At(x, y);
+  sprite.SetScale(scale);
   sprite.SetColor(selected ? smk::Color::White : colorNonSelected);
-  sprite.SetPosition(x, y);
-  window.Draw(sprite);
+  target.Draw(sprite);
 }
 
 void Hero::UpdateGeometry() {
@@ -2,8 +2,10 @@
 #define GAME_HERO_HPP
 
 #include "game/Collision.hpp"
+#include "game/DrawList.hpp"
 #include "game/Resource.hpp"
-#include <smk/Sprite.hpp>
+#include "game/TelemetryEvent.hpp"
+#include <vector>
 
 namespace smk {
 class Window;
@@ -12,22 +14,26 @@ class Window;
 class Hero {
  public:
   Rectangle geometry;
-  smk::Sprite sprite;
   float x = 0.f;
   float y = 0.f;
   float xspeed = 0.f;
   float yspeed = 0.f;
   int life;
+  DeathCause cause = DeathCause::Unknown;  // Of the last damage.
   bool sens = true;
+  float scale = 1.f;  // Of the drawing only.
 
   bool in_laser = false;
 
+  // Sorted ids of the sensors overlapped. See SensorSystem.
+  std::vector<int> sensors;
+
   //Hero();
   Hero(float x, float y);
   void SetPosition(float x, float y);
   void UpdateGeometry();
 
-  void Draw(smk::Window& window, bool selected);
+  void Draw(DrawList& target, bool selected);
 };
 
 #endif /* GAME_HERO_HPP */
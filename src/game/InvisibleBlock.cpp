@@ -1,12 +1,17 @@
 #include "game/InvisibleBlock.hpp"
+#include "game/SpriteTemplate.hpp"
 #include <smk/Window.hpp>
 #include <cmath>
 
+namespace {
+const SpriteTemplate kInvisibleBlock(img_block4);
+}  // namespace
+
 float sqr(float x) {
   return x * x;
 }
 
-void InvisibleBlock::Draw(smk::Window& window, const Hero& hero) {
+void InvisibleBlock::Draw(DrawList& target, const Hero& hero) {
   float distance =
       std::sqrt(sqr((hero.geometry.left + hero.geometry.right) / 2 -
                     (geometry.left + geometry.right) / 2) +
@@ -18,8 +23,11 @@ void InvisibleBlock::Draw(smk::Window& window, const Hero& hero) {
     coef = 1.0;
   else if (coef < 0)
     coef = 0;
+  auto sprite = kInvisibleBlock.At(geometry.left, geometry.top);
+  sprite.SetScale((geometry.right - geometry.left) / 31.f,
+                  (geometry.bottom - geometry.top) / 31.f);
   sprite.SetColor(glm::vec4(1.0, 1.0, 1.0, coef));
-  window.Draw(sprite);
+  target.Draw(sprite);
 }
 
 InvisibleBlock::InvisibleBlock(int x, int y, int width, int height) {
@@ -27,7 +35,4 @@ InvisibleBlock::InvisibleBlock(int x, int y, int width, int height) {
   geometry.top = y;
   geometry.right = x + width - 1;
   geometry.bottom = y + height - 1;
-  sprite = smk::Sprite(img_block4);
-  sprite.SetPosition(x, y);
-  sprite.SetScale(float(width - 1) / 31.0, float(height - 1) / 31.0);
 }
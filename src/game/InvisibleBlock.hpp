@@ -3,15 +3,14 @@
 
 #include "game/Forme.hpp"
 #include "game/Hero.hpp"
-#include <smk/Window.hpp>
+#include "game/DrawList.hpp"
 
 class InvisibleBlock {
  public:
   Rectangle geometry;
-  smk::Sprite sprite;
 
   InvisibleBlock(int x, int y, int width, int height);
-  void Draw(smk::Window& window, const Hero& hero);
+  void Draw(DrawList& target, const Hero& hero);
 };
 
 #endif /* GAME_INVISIBLE_BLOCK_HPP */
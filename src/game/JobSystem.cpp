@@ -0,0 +1,61 @@
+#include "game/JobSystem.hpp"
+
+JobSystem::JobSystem(int threads) {
+  for (int i = 1; i < threads; ++i)
+    workers_.emplace_back([this] { Work(); });
+}
+
+JobSystem::~JobSystem() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    quit_ = true;
+  }
+  wake_.notify_all();
+  for (auto& worker : workers_)
+    worker.join();
+}
+
+void JobSystem::Run(const std::vector<std::function<void()>>& jobs) {
+  if (jobs.empty())
+    return;
+
+  // Nothing to share.
+  if (jobs.size() == 1 || workers_.empty()) {
+    for (auto& job : jobs)
+      job();
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  batch_ = &jobs;
+  next_ = 0;
+  remaining_ = jobs.size();
+  wake_.notify_all();
+
+  Help(lock);
+  done_.wait(lock, [this] { return remaining_ == 0; });
+  batch_ = nullptr;
+}
+
+void JobSystem::Work() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    wake_.wait(lock, [this] {
+      return quit_ || (batch_ && next_ < batch_->size());
+    });
+    if (quit_)
+      return;
+    Help(lock);
+  }
+}
+
+void JobSystem::Help(std::unique_lock<std::mutex>& lock) {
+  while (batch_ && next_ < batch_->size()) {
+    const std::function<void()>& job = (*batch_)[next_++];
+    lock.unlock();
+    job();
+    lock.lock();
+    if (--remaining_ == 0)
+      done_.notify_all();
+  }
+}
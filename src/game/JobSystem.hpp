@@ -0,0 +1,42 @@
+#ifndef GAME_JOB_SYSTEM_HPP
+#define GAME_JOB_SYSTEM_HPP
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A fixed pool of threads running batches of independent jobs. The thread
+// calling Run() takes part in the batch.
+class JobSystem {
+ public:
+  // |threads| counts the calling thread.
+  explicit JobSystem(int threads);
+  ~JobSystem();
+
+  JobSystem(const JobSystem&) = delete;
+  JobSystem& operator=(const JobSystem&) = delete;
+
+  // Call every job once, and return when they are all done.
+  void Run(const std::vector<std::function<void()>>& jobs);
+
+  int threads() const { return workers_.size() + 1; }
+
+ private:
+  void Work();
+  // Run jobs of the current batch until there are none left. |lock| is held
+  // on entry and on exit.
+  void Help(std::unique_lock<std::mutex>& lock);
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  const std::vector<std::function<void()>>* batch_ = nullptr;
+  size_t next_ = 0;
+  size_t remaining_ = 0;
+  bool quit_ = false;
+  std::vector<std::thread> workers_;
+};
+
+#endif /* GAME_JOB_SYSTEM_HPP */
@@ -2,31 +2,98 @@
 
 #include <codecvt>
 #include <fstream>
-#include <iostream>
 #include <locale>
 #include <map>
+#include <memory>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
 
 namespace {
+
 std::wstring to_wstring(const std::string& s) {
   std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
   return converter.from_bytes(s);
 }
-}  // namespace
 
-std::map<std::wstring, std::wstring> textMap;
-void LoadTraduction(std::string fileName) {
+// Every string of a language, stored one after the other.
+struct Table {
+  std::wstring arena;
+  struct Entry {
+    size_t begin = 0;
+    size_t size = 0;
+  };
+  Entry entries[size_t(TextId::Count)];
+};
+
+TextId Id(std::wstring_view name) {
+  static const std::unordered_map<std::wstring_view, TextId> ids = {
+#define X(id) {L"" #id, TextId::id},
+      TEXT_IDS(X)
+#undef X
+  };
+  auto it = ids.find(name);
+  return it != ids.end() ? it->second : TextId::Count;
+}
+
+std::unique_ptr<Table> Load(const std::string& fileName) {
+  auto table = std::make_unique<Table>();
+
   std::ifstream file(fileName.c_str());
   if (!file)
-    return;
+    return table;
+
+  // Decode the whole file at once. The lines alternate between ids and
+  // strings.
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  std::wstring content = to_wstring(buffer.str());
+  table->arena.reserve(content.size());
 
-  std::string id;
-  while (std::getline(file, id)) {
-    std::string text;
-    std::getline(file, text);
-    textMap[to_wstring(id)] = to_wstring(text);
+  size_t position = 0;
+  auto next_line = [&](std::wstring_view& line) {
+    if (position >= content.size())
+      return false;
+    size_t end = content.find(L'\n', position);
+    if (end == std::wstring::npos)
+      end = content.size();
+    line = std::wstring_view(content).substr(position, end - position);
+    position = end + 1;
+    return true;
+  };
+
+  std::wstring_view id;
+  std::wstring_view text;
+  while (next_line(id)) {
+    if (!next_line(text))
+      text = {};
+    TextId text_id = Id(id);
+    if (text_id == TextId::Count)
+      continue;
+    auto& entry = table->entries[size_t(text_id)];
+    entry.begin = table->arena.size();
+    entry.size = text.size();
+    table->arena += text;
   }
+  return table;
+}
+
+std::map<std::string, std::unique_ptr<Table>> tables;
+const Table* current = nullptr;
+
+}  // namespace
+
+void LoadTraduction(std::string fileName) {
+  auto& table = tables[fileName];
+  if (!table)
+    table = Load(fileName);
+  current = table.get();
 }
 
-std::wstring tr(std::wstring id) {
-  return textMap[id];
+// Only read once loaded, so it can be used from several threads.
+std::wstring_view tr(TextId id) {
+  if (!current)
+    return {};
+  const auto& entry = current->entries[size_t(id)];
+  return std::wstring_view(current->arena).substr(entry.begin, entry.size);
 }
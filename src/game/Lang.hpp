@@ -2,8 +2,22 @@
 #define GAME_LANG_HPP
 
 #include <string>
+#include <string_view>
+#include "game/TextIds.hpp"
 
+// Every translated string, named after its id in the lang files. TEXT_IDS is
+// generated from them when configuring, see TextIds.hpp.in.
+enum class TextId {
+#define X(name) name,
+  TEXT_IDS(X)
+#undef X
+  Count,
+};
+
+// Switch language. Each file is read once, switching back is free.
 void LoadTraduction(std::string fileName);
-std::wstring tr(std::wstring id);
+
+// Empty when the current language has no translation for |id|.
+std::wstring_view tr(TextId id);
 
 #endif /* GAME_LANG_HPP */
@@ -1,12 +1,17 @@
 #ifndef GAME_LASER_HPP
 #define GAME_LASER_HPP
 
-#include <smk/Window.hpp>
+#include "game/DrawList.hpp"
+#include "game/LineBatch.hpp"
+#include "game/Random.hpp"
 
 struct Laser {
   glm::vec2 start;
   glm::vec2 end;
-  void Draw(smk::Window& window);
+  // The beam is appended to |core| and |glow|, drawn later by the caller.
+  void AddBeam(LineBatch& core, LineBatch& glow) const;
+  // The halo on the impact.
+  void Draw(DrawList& target, Random& random) const;
 };
 
 #endif /* end of include guard: GAME_LASER_HPP */
@@ -1,10 +1,16 @@
 #include "game/LaserTurret.hpp"
 
 #include <cmath>
+#include "game/Fixed.hpp"
 #include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
 #include <smk/Window.hpp>
-#include <smk/Shape.hpp>
-#include <smk/Color.hpp>
+
+namespace {
+const SpriteTemplate kTurret(img_turret, [](smk::Sprite& sprite) {
+  sprite.SetCenter(10, 3);
+});
+}  // namespace
 
 LaserTurret::LaserTurret(int X,
                          int Y,
@@ -22,35 +28,33 @@ LaserTurret::LaserTurret(int X,
   angleSpeed = AngleSpeed;
   angleIncrement = 0;
 
-  sprite = smk::Sprite(img_turret);
-  sprite.SetCenter(10, 3);
-  sprite.SetRotation(angle);
-  sprite.SetPosition(x, y);
-
   if (mode == 2)
     angleMedium = Angle;
 }
 
-void LaserTurret::Draw(smk::Window& window) {
-  auto line =
-      smk::Shape::Line(glm::vec2(x, y), glm::vec2(xattach, yattach), 1);
-  line.SetColor(smk::Color::Black);
-  window.Draw(line);
-  window.Draw(sprite);
+void LaserTurret::AddTether(LineBatch& lines) const {
+  lines.Add(glm::vec2(x, y), glm::vec2(xattach, yattach), 1);
+}
+
+void LaserTurret::Draw(DrawList& target) {
+  auto sprite = kTurret.At(x, y);
+  sprite.SetRotation(angle);
+  target.Draw(sprite);
 }
 
-void LaserTurret::Step() {
+void LaserTurret::Step(bool fixed_point) {
   switch (mode) {
     case 0:
       break;
     case 1:
       angle += angleSpeed;
-      sprite.SetRotation(angle);
       break;
     case 2:
       angleIncrement += angleSpeed;
-      angle = angleMedium + 45 * std::sin(angleIncrement * 0.0174532925);
-      sprite.SetRotation(angle);
+      if (fixed_point)
+        angle = angleMedium + int(45 * SinDegrees(angleIncrement));
+      else
+        angle = angleMedium + 45 * std::sin(angleIncrement * 0.0174532925);
       break;
   }
 }
@@ -1,7 +1,9 @@
 #ifndef GAME_LASER_TURRET_HPP
 #define GAME_LASER_TURRET_HPP
 
-#include <smk/Sprite.hpp>
+#include "game/DrawList.hpp"
+#include "game/LineBatch.hpp"
+
 namespace smk {
 class Window;
 }  // namespace smk
@@ -13,7 +15,6 @@ class LaserTurret {
   int angleSpeed;
   int angleIncrement;  // used when mode=2
   int angleMedium;     // used when mode=2
-  smk::Sprite sprite;
   LaserTurret(int X,
               int Y,
               int Angle,
@@ -21,8 +22,10 @@ class LaserTurret {
               int Yattach,
               int Mode,
               int AngleSpeed);
-  void Draw(smk::Window& window);
-  void Step();
+  // The line to the attach point, drawn later by the caller.
+  void AddTether(LineBatch& lines) const;
+  void Draw(DrawList& target);
+  void Step(bool fixed_point);
 };
 
 #endif /* GAME_LASER_TURRET_HPP */
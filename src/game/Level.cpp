@@ -1,16 +1,67 @@
 #include "game/Level.hpp"
 #include <algorithm>
-#include <random>
+#include <limits>
 #include <smk/Input.hpp>
 #include <smk/Shape.hpp>
 #include <smk/Text.hpp>
 #include <smk/View.hpp>
-#include "game/BackgroundMusic.hpp"
+#include "game/Fixed.hpp"
 #include "game/Lang.hpp"
-
-auto rng = std::default_random_engine{};
-
-extern BackgroundMusic background_music;
+#include "game/SpriteTemplate.hpp"
+
+namespace {
+const smk::SoundBuffer no_music;
+const SpriteTemplate kHeart(img_coeur);
+}  // namespace
+
+// What the phases of Step touch. PlaceFree and CollisionWithAllBlock read
+// kBodies.
+namespace {
+enum : PhaseGraph::Resources {
+  kHeroes = 1 << 0,  // With heroSelected, nbHero, timeDead.
+  kMovingBlocks = 1 << 1,
+  kFallingBlocks = 1 << 2,
+  kMovableBlocks = 1 << 3,
+  kGlass = 1 << 4,
+  kSensors = 1 << 5,  // With the detectors and the text popups.
+  kPics = 1 << 6,     // With the logic graph.
+  kCreepers = 1 << 7,
+  kCloners = 1 << 8,
+  kArrowLaunchers = 1 << 9,  // With their detectors.
+  kArrows = 1 << 10,
+  kParticles = 1 << 11,
+  kSounds = 1 << 12,
+  kPincettes = 1 << 13,
+  kButtons = 1 << 14,
+  kLaserTurrets = 1 << 15,
+  kElectricity = 1 << 16,
+  kLasers = 1 << 17,
+  kRandom = 1 << 18,
+  kView = 1 << 19,
+  kOutcome = 1 << 20,  // isWin, isLose.
+  kTelemetry = 1 << 21,
+
+  kBodies = kHeroes | kMovingBlocks | kFallingBlocks | kMovableBlocks | kGlass,
+  kEverything = ~PhaseGraph::Resources(0),
+
+  // What Step changes by itself, outside of the phases.
+  kStepWrites = kFallingBlocks | kRandom | kOutcome,
+};
+
+// The parts of the state hash. The lasers are recomputed every tick, the view
+// and the sounds are not simulated. The specials are written by a phase
+// writing everything.
+// clang-format off
+const PhaseGraph::Resources kHashedResources[] = {
+  kHeroes, kMovingBlocks, kFallingBlocks, kMovableBlocks, kGlass, kSensors,
+  kPics, kCreepers, kCloners, kArrowLaunchers, kArrows, kParticles,
+  kPincettes, kButtons, kLaserTurrets, kElectricity, kRandom, kOutcome,
+  kEverything,
+};
+// clang-format on
+const int kHashedResourceCount =
+    sizeof(kHashedResources) / sizeof(kHashedResources[0]);
+}  // namespace
 
 // clang-format off
 float InRange(float x, float a, float b) {
@@ -32,6 +83,7 @@ void Level::LoadFromFile(std::string fileName) {
     std::stringstream ss(line);
     std::string identifier;
     std::getline(ss, identifier, ' ');
+    source_[identifier].push_back(line);
     // blocks
     if (identifier == "b") {
       int x, y, width, height;
@@ -147,7 +199,7 @@ void Level::LoadFromFile(std::string fileName) {
     else if (identifier == "creeper") {
       int x, y, width, height;
       ss >> x >> y >> width >> height;
-      creeper_list.emplace_back(x, y);
+      creeper_list.emplace_back(x, y, random_);
     }
     // adding Arrow launcher
     else if (identifier == "arrowLauncher") {
@@ -190,11 +242,9 @@ void Level::LoadFromFile(std::string fileName) {
       int x, y, angle, nbRequis, comparateur;
       ss >> x >> y >> angle >> nbRequis >> comparateur;
       std::vector<int> connexion;
-      while (ss) {
-        int detectorId;
-        ss >> detectorId;
+      int detectorId;
+      while (ss >> detectorId)
         connexion.push_back(detectorId);
-      }
       pic_list.emplace_back(x, y, angle, nbRequis, comparateur, connexion);
     }
     // adding Accelerator
@@ -214,7 +264,30 @@ void Level::LoadFromFile(std::string fileName) {
   }
   file.close();
 
-  spriteBackground = smk::Sprite(img_background);
+  // The Fixed motion starts from values representable as Fixed.
+  if (fixed_point) {
+    auto quantize = [](float& value) { value = float(Fixed(value)); };
+    for (auto& it : hero_list) {
+      quantize(it.x);
+      quantize(it.y);
+      it.UpdateGeometry();
+    }
+    for (auto& it : movBlock_list) {
+      quantize(it.xspeed);
+      quantize(it.yspeed);
+    }
+  }
+
+  {
+    std::vector<Rectangle> static_blocks;
+    for (auto& it : block_list) static_blocks.push_back(it.geometry);
+    for (auto& it : invBlock_list) static_blocks.push_back(it.geometry);
+    static_blocks_.Build(static_blocks);
+    for (auto& it : static_blocks) static_boxes_.Add(it);
+  }
+  BuildSensors();
+  logic_graph_.Build(detector_list.size(), pic_list);
+  BuildPhases();
 
   int separator_position = 0;
   {
@@ -228,86 +301,91 @@ void Level::LoadFromFile(std::string fileName) {
   fileName = fileName.substr(separator_position, -1);
 
   if (fileName == "IntroductionPincette")
-    background_music.SetSound(smk::SoundBuffer());
+    music_ = &no_music;
   else if (fileName == "LevelArbreBoss")
-    background_music.SetSound(SB_backgroundMusicAction);
+    music_ = &SB_backgroundMusicAction;
   else if (fileName == "LevelEnd")
-    background_music.SetSound(SB_end);
+    music_ = &SB_end;
   else if (fileName == "LevelEnd2")
-    background_music.SetSound(SB_end);
+    music_ = &SB_end;
   else
-    background_music.SetSound(SB_backgroundMusic);
+    music_ = &SB_backgroundMusic;
 
   // The initial view position.
   auto geometry = hero_list[heroSelected].geometry;
   xcenter = geometry.left;
   ycenter = geometry.top;
+
+  level_id_ = TelemetryLevelId(fileName);
+
+  InvalidateStateHash(kEverything);
 }
 
-void Level::Draw(smk::Window& window) {
-  window.SetView(view_);
+void Level::Draw(DrawList& target) {
+  target.SetView(view_);
 
-  // clang-format off
-  for (int x = xcenter - 320 - int(xcenter / 2.67) % 24; x < xcenter + 320; x += 24) {
-  for (int y = ycenter - 240 - int(ycenter / 2.67) % 24; y < ycenter + 240; y += 24) {
-      spriteBackground.SetPosition(x, y);
-      window.Draw(spriteBackground);
-    }
-  }
+  // The background scrolls slower than the level.
+  int x = xcenter - 320 - int(xcenter / 2.67) % 24;
+  int y = ycenter - 240 - int(ycenter / 2.67) % 24;
+  background_.Draw(target, {x, y}, {640 + 24, 480 + 24});
 
-  for (auto& it : special_list) it.DrawBackground(window, xcenter, ycenter);
-  for (auto& it : decorBack_list) it.Draw(window);
-  for (auto& it : special_list) it.DrawOverDecoration(window);
+  // clang-format off
+  for (auto& it : special_list) it.DrawBackground(target, xcenter, ycenter);
+  for (auto& it : decorBack_list) it.Draw(target);
+  for (auto& it : special_list) it.DrawOverDecoration(target);
   // clang-format on
 
 
-  // Draw static turrets and throw out Laser
-  for (auto& it : laserTurret_list) {
-    it.Draw(window);
-    EmitLaser(window, it.x, it.y, it.angle, 10);
-  }
+  // Draw static turrets
+  for (auto& it : laserTurret_list)
+    it.AddTether(tether_lines_);
+  tether_lines_.Draw(target);
+  for (auto& it : laserTurret_list)
+    it.Draw(target);
 
   // clang-format off
-  for (auto& it : block_list) it.Draw(window);
-  for (auto& it : invBlock_list) it.Draw(window, hero_list[heroSelected]);
-  for (auto& it : movBlock_list) it.Draw(window);
-  for (auto& it : fallBlock_list) it.Draw(window);
-  for (auto& it : movableBlock_list) it.Draw(window);
-  for (auto& it : glassBlock_list) it.Draw(window);
-  for (auto& it : staticMiroir_list) it.Draw(window);
-  for (auto& it : pic_list) it.Draw(window);
-  for (auto& it : special_list) it.DrawForeground(window, isWin);
-  for (auto& it : button_list) it.Draw(window);
+  for (auto& it : block_list) it.Draw(target);
+  for (auto& it : invBlock_list) it.Draw(target, hero_list[heroSelected]);
+  for (auto& it : movBlock_list) it.Draw(target);
+  for (auto& it : fallBlock_list) it.Draw(target);
+  for (auto& it : movableBlock_list) it.Draw(target);
+  for (auto& it : glassBlock_list) it.Draw(target);
+  for (auto& it : staticMiroir_list) it.Draw(target);
+  for (auto& it : pic_list) it.Draw(target);
+  for (auto& it : special_list) it.DrawForeground(target, input_ & Input::Space, isWin);
+  for (auto& it : button_list) it.Draw(target);
+  for (auto& it : ghosts) it->Draw(target, time);
   int i = 0;
-  for (auto& it : hero_list) it.Draw(window, heroSelected == i++);
-  for (auto& it : creeper_list) it.Draw(window);
-  for (auto& it : arrow_list) it.Draw(window);
-  for (auto& it : arrowLauncher_list) it.Draw(window);
-  for (auto& it : cloneur_list) it.Draw(window);
-  for (auto& it : particule_list) it.Draw(window);
-  for (auto& it : electricity_list) it.Draw(window);
-  for (auto& it : laser_) it.Draw(window);
-  for (auto& pincette : pincette_list) pincette.Draw(window);
-  for (auto& it : decorFront_list) it.Draw(window);
+  for (auto& it : hero_list) it.Draw(target, heroSelected == i++);
+  for (auto& it : creeper_list) it.Draw(target);
+  arrow_pool.Draw(target);
+  for (auto& it : arrowLauncher_list) it.Draw(target);
+  for (auto& it : cloneur_list) it.Draw(target);
+  for (auto& it : particule_list) it.Draw(target);
+  for (auto& it : electricity_list) it.Draw(target, electricity_glow_, electricity_core_);
+  electricity_glow_.Draw(target);
+  electricity_core_.Draw(target);
+  for (auto& it : laser_) it.AddBeam(laser_core_, laser_glow_);
+  laser_core_.Draw(target);
+  laser_glow_.Draw(target);
+  for (auto& it : laser_) it.Draw(target, draw_random_);
+  for (auto& pincette : pincette_list) pincette.Draw(target);
+  for (auto& it : decorFront_list) it.Draw(target);
 
   // drawing life bar
-  auto coeur = smk::Sprite(img_coeur);
   if (!hero_list.empty()) {
-    for (int i = 1; i <= hero_list[heroSelected].life; i++) {
-      coeur.SetPosition(xcenter + i * 16 - 320, ycenter + 220);
-      window.Draw(coeur);
-    }
+    for (int i = 1; i <= hero_list[heroSelected].life; i++)
+      target.Draw(kHeart.At(xcenter + i * 16 - 320, ycenter + 220));
   }
 
-  for(auto& it : drawn_textpopup_list) it.Draw(window);
+  for(auto& it : drawn_textpopup_list) it.Draw(target);
   // clang-format on
-  laser_.clear();
 }
 
-void Level::Step(Input::T input, smk::Window& window) {
-  std::shuffle(std::begin(fallBlock_list), std::end(fallBlock_list), rng);
+void Level::Step(Input::T input) {
+  std::shuffle(std::begin(fallBlock_list), std::end(fallBlock_list), random_);
 
-  SetView(window);
+  SetView();
 
   /////////////////////////////////
   //        extra key            //
@@ -316,6 +394,8 @@ void Level::Step(Input::T input, smk::Window& window) {
   // test if the player will end the game
   isEscape = input & Input::Escape;
   isLose = input & Input::Restart;
+  if (isLose)
+    Record(TelemetryEvent{0, 0, 0.f, 0.f, TelemetryType::Restart});
 
   //if (window.input().IsKeyPressed(GLFW_KEY_T)) {
     //isWin = true;
@@ -327,8 +407,9 @@ void Level::Step(Input::T input, smk::Window& window) {
   // Drawn popup
   for (auto it = drawn_textpopup_list.begin(); it != drawn_textpopup_list.end();
        ++it) {
-    if (it->Step(window))
+    if (it->Step(input & Input::Next))
       drawn_textpopup_list.erase(it);
+    InvalidateStateHash(kStepWrites | kSensors);
     return;
   }
 
@@ -337,20 +418,465 @@ void Level::Step(Input::T input, smk::Window& window) {
   //////////////////////////////////
 
   time++;
+  sensor_events_.clear();
+  input_ = input;
+  bool was_win = isWin;
+
+  if (phases_.graph.size() == 0)
+    BuildPhases();
+  phases_.graph.Run(job_system,
+                    [this](int phase, PhaseGraph::Resources resources) {
+                      Publish(phase, resources);
+                    });
+  if (isWin && !was_win && !hero_list.empty()) {
+    const Hero& hero = hero_list[heroSelected];
+    Record(TelemetryEvent{0, 0, hero.x, hero.y, TelemetryType::Win});
+  }
+  UpdateSounds();
+  InvalidateStateHash(kStepWrites | phases_.graph.writes());
+}
+
+void Level::Reload(const std::string& fileName) {
+  Level fresh;
+  fresh.fixed_point = fixed_point;
+  fresh.job_system = job_system;
+  fresh.ghosts = ghosts;
+  fresh.LoadFromFile(fileName);
+  // Half written, or not a level. Keep playing the previous one.
+  if (fresh.hero_list.empty())
+    return;
+  fresh.telemetry = telemetry;
+  fresh.audio = audio;
+
+  // The objects staying at their index: an object keeps its state when the
+  // file still has its line.
+  auto match = [&](const char* identifier, const auto& live, auto& reloaded) {
+    const auto& old_lines = source_[identifier];
+    const auto& new_lines = fresh.source_[identifier];
+    std::vector<bool> matched(old_lines.size(), false);
+    for (size_t i = 0; i < new_lines.size(); ++i) {
+      for (size_t j = 0; j < old_lines.size(); ++j) {
+        if (!matched[j] && old_lines[j] == new_lines[i]) {
+          matched[j] = true;
+          reloaded[i] = live[j];
+          break;
+        }
+      }
+    }
+  };
+  match("mm", movBlock_list, fresh.movBlock_list);
+  match("m", movableBlock_list, fresh.movableBlock_list);
+  match("pic", pic_list, fresh.pic_list);
+  match("button", button_list, fresh.button_list);
+  match("l", laserTurret_list, fresh.laserTurret_list);
+  match("clone", cloneur_list, fresh.cloneur_list);
+  match("pincette", pincette_list, fresh.pincette_list);
+  match("arrowLauncherDetector", arrowLauncherDetector_list,
+        fresh.arrowLauncherDetector_list);
+
+  // The objects removed or reordered while playing: kept only when none of
+  // their lines changed.
+  auto keep = [&](const char* identifier, const auto& live, auto& reloaded) {
+    if (source_[identifier] == fresh.source_[identifier])
+      reloaded = live;
+  };
+  keep("f", fallBlock_list, fresh.fallBlock_list);
+  keep("g", glassBlock_list, fresh.glassBlock_list);
+  keep("creeper", creeper_list, fresh.creeper_list);
+  keep("special", special_list, fresh.special_list);
+  keep("textpopup", textpopup_list, fresh.textpopup_list);
+  keep("textpopup", drawn_textpopup_list, fresh.drawn_textpopup_list);
+
+  // The sensors refer to the objects kept. The heroes enter them again on
+  // the next Step, which sets the detectors and the logic graph.
+  fresh.sensors_ = SensorSystem();
+  fresh.BuildSensors();
+  fresh.hero_list = hero_list;
+  for (Hero& hero : fresh.hero_list)
+    hero.sensors.clear();
+  fresh.heroSelected = heroSelected;
+  fresh.nbHero = nbHero;
+  fresh.time = time;
+  fresh.timeDead = timeDead;
+  fresh.isWin = isWin;
+  fresh.isLose = isLose;
+  fresh.space_pressed_ = space_pressed_;
+  fresh.random_ = random_;
+  fresh.draw_random_ = draw_random_;
+  fresh.xcenter = xcenter;
+  fresh.ycenter = ycenter;
+  fresh.particule_list = particule_list;
+  fresh.arrow_pool = arrow_pool;
+
+  *this = fresh;
+  InvalidateStateHash(kEverything);
+}
+
+GhostSample Level::ghost_sample() const {
+  GhostSample sample;
+  if (!hero_list.empty()) {
+    const Hero& hero = hero_list[heroSelected];
+    sample.x = hero.x;
+    sample.y = hero.y;
+    sample.left = hero.sens;
+  }
+  return sample;
+}
+
+float Level::DistanceToFinish() const {
+  auto center = [](const Rectangle& r) {
+    return glm::vec2(r.left + r.right, r.top + r.bottom) * 0.5f;
+  };
+  glm::vec2 finish = center(enddingBlock.geometry);
+  float distance = std::numeric_limits<float>::infinity();
+  for (const Hero& hero : hero_list)
+    distance = std::min(distance, glm::length(center(hero.geometry) - finish));
+  return distance;
+}
+
+uint64_t Level::PositionKey(float cell) const {
+  uint64_t key = 14695981039346656037ull;
+  auto add = [&](int64_t value) {
+    key ^= uint64_t(value);
+    key *= 1099511628211ull;
+  };
+  auto add_position = [&](float x, float y) {
+    add(int64_t(std::floor(x / cell)));
+    add(int64_t(std::floor(y / cell)));
+  };
+
+  add(textpopup_list.size());
+  add(drawn_textpopup_list.size());
+  for (const TextPopup& popup : drawn_textpopup_list) {
+    add(popup.page());
+    add(std::min(popup.page_time(), 16));
+  }
+  add(heroSelected);
+  add(hero_list.size());
+  for (const Hero& hero : hero_list) {
+    add_position(hero.x, hero.y);
+    add_position(hero.xspeed, hero.yspeed);
+  }
+  for (const MovableBlock& block : movableBlock_list)
+    add_position(block.x, block.y);
+  for (const MovingBlock& block : movBlock_list)
+    add_position(block.x, block.y);
+  for (const Pic& pic : pic_list)
+    add_position(pic.x, pic.y);
+  // Shuffled every step: summed, so that the order doesn't matter.
+  uint64_t falling = 0;
+  for (const FallingBlock& block : fallBlock_list) {
+    falling += uint64_t(std::floor(block.x / cell)) * 0x9E3779B97F4A7C15ull ^
+               uint64_t(std::floor(block.y / cell));
+  }
+  add(falling);
+  add(glassBlock_list.size());
+  add(creeper_list.size());
+  for (const Detector& detector : detector_list)
+    add(detector.detected);
+  return key;
+}
+
+void Level::BuildPhases() {
+  phases_.graph.Clear();
+  auto add = [&](const char* name, PhaseGraph::Resources reads,
+                 PhaseGraph::Resources writes, PhaseGraph::Resources appends,
+                 void (Level::*step)(Spawned&)) {
+    phases_.graph.Add(name, reads, writes, appends, [this, step](int phase) {
+      (this->*step)(phases_.spawned[phase]);
+    });
+  };
+
+  // clang-format off
+  add("heroes", kBodies, kHeroes | kSensors | kOutcome, kParticles | kTelemetry, &Level::StepHeroes);
+  if (!movBlock_list.empty())
+    add("moving blocks", kBodies, kMovingBlocks | kHeroes, 0, &Level::StepMovingBlocks);
+  if (!fallBlock_list.empty())
+    add("falling blocks", kBodies, kFallingBlocks, 0, &Level::StepFallingBlocks);
+  if (!movableBlock_list.empty())
+    add("movable blocks", kBodies, kMovableBlocks, 0, &Level::StepMovableBlocks);
+  if (!glassBlock_list.empty())
+    add("glass", kBodies, kGlass, 0, &Level::StepGlass);
+  add("sensors", kHeroes, kSensors | kPics | kOutcome, 0, &Level::StepSensors);
+  if (!pic_list.empty())
+    add("pics", 0, kPics | kHeroes, 0, &Level::StepPics);
+  if (!accelerator_list.empty())
+    add("accelerators", kSensors, kHeroes, 0, &Level::StepAccelerators);
+  if (!creeper_list.empty())
+    add("creepers", kBodies, kCreepers | kHeroes | kRandom, kParticles | kSounds, &Level::StepCreepers);
+  if (!cloneur_list.empty())
+    add("cloners", 0, kCloners | kHeroes | kRandom, kParticles, &Level::StepCloners);
+  if (!arrowLauncherDetector_list.empty())
+    add("arrow launchers", kSensors, kArrowLaunchers | kArrows, kSounds, &Level::StepArrowLaunchers);
+  add("arrows", kBodies, kArrows | kHeroes | kRandom, kParticles, &Level::StepArrows);
+  add("particles", 0, kParticles, 0, &Level::StepParticles);
+  if (!pincette_list.empty())
+    add("pincettes", 0, kPincettes, 0, &Level::StepPincettes);
+  if (!special_list.empty())
+    add("specials", kEverything, kEverything, kTelemetry, &Level::StepSpecials);
+  if (!button_list.empty())
+    add("buttons", kSensors, kButtons, 0, &Level::StepButtons);
+  if (!pincette_list.empty())
+    add("pincettes", 0, kPincettes, 0, &Level::StepPincettes);
+  if (!laserTurret_list.empty())
+    add("laser turrets", 0, kLaserTurrets, 0, &Level::StepLaserTurrets);
+  if (!glassBlock_list.empty())
+    add("glass in laser", 0, kGlass, 0, &Level::StepGlassInLaser);
+  if (!teleporter_list.empty())
+    add("teleporters", kSensors, kHeroes | kView, 0, &Level::StepTeleporters);
+  if (!electricity_list.empty())
+    add("electricity", 0, kElectricity, 0, &Level::StepElectricity);
+  if (!electricity_list.empty())
+    add("electricity on heroes", kElectricity | kSensors, kHeroes, 0, &Level::StepElectricityOnHeroes);
+  if (!laserTurret_list.empty())
+    add("lasers", kBodies | kLaserTurrets, kLasers | kHeroes | kGlass | kRandom, kParticles, &Level::StepLasers);
+  // clang-format on
+
+  phases_.graph.Build();
+  phases_.spawned.resize(phases_.graph.size());
+}
+
+uint64_t Level::state_hash() const {
+  if (state_parts_.empty()) {
+    state_parts_.resize(kHashedResourceCount);
+    state_written_ = kEverything;
+  }
+
+  StateHash hash;
+  hash.Add(time);
+  hash.Add(fixed_point);
+  for (int i = 0; i < kHashedResourceCount; ++i) {
+    if ((state_written_ & kHashedResources[i]) == kHashedResources[i])
+      state_parts_[i] = HashPart(kHashedResources[i]);
+    hash.Add(state_parts_[i]);
+  }
+  state_written_ = 0;
+  return hash.value();
+}
+
+uint64_t Level::HashPart(PhaseGraph::Resources resource) const {
+  StateHash hash;
+  auto add_list = [&](const auto& list, auto add) {
+    hash.Add(int(list.size()));
+    for (const auto& it : list)
+      add(it);
+  };
+
+  switch (resource) {
+    case kHeroes:
+      hash.Add(heroSelected);
+      hash.Add(nbHero);
+      hash.Add(timeDead);
+      hash.Add(space_pressed_);
+      add_list(hero_list, [&](const Hero& it) {
+        hash.Add(it.x);
+        hash.Add(it.y);
+        hash.Add(it.xspeed);
+        hash.Add(it.yspeed);
+        hash.Add(it.life);
+        hash.Add(it.sens);
+        hash.Add(it.in_laser);
+      });
+      break;
+
+    case kMovingBlocks:
+      add_list(movBlock_list, [&](const MovingBlock& it) {
+        hash.Add(it.x);
+        hash.Add(it.y);
+        hash.Add(it.xspeed);
+        hash.Add(it.yspeed);
+      });
+      break;
+
+    case kFallingBlocks:
+      // In the shuffled order: the next Step depends on it.
+      add_list(fallBlock_list, [&](const FallingBlock& it) {
+        hash.Add(it.x);
+        hash.Add(it.y);
+        hash.Add(it.yspeed);
+        hash.Add(it.etape);
+      });
+      break;
+
+    case kMovableBlocks:
+      add_list(movableBlock_list, [&](const MovableBlock& it) {
+        hash.Add(it.x);
+        hash.Add(it.y);
+        hash.Add(it.xspeed);
+        hash.Add(it.yspeed);
+      });
+      break;
+
+    case kGlass:
+      add_list(glassBlock_list, [&](const Glass& it) {
+        hash.Add(it.x);
+        hash.Add(it.y);
+        hash.Add(it.xspeed);
+        hash.Add(it.yspeed);
+        hash.Add(it.in_laser);
+      });
+      break;
+
+    case kSensors:
+      add_list(detector_list, [&](const Detector& it) {  //
+        hash.Add(it.detected);
+      });
+      hash.Add(int(textpopup_list.size()));
+      add_list(drawn_textpopup_list, [&](const TextPopup& it) {
+        hash.Add(it.page());
+        hash.Add(it.page_time());
+      });
+      break;
+
+    case kPics:
+      add_list(pic_list, [&](const Pic& it) {  //
+        hash.Add(it.avancement);
+      });
+      break;
+
+    case kCreepers:
+      add_list(creeper_list, [&](const Creeper& it) {
+        hash.Add(it.x);
+        hash.Add(it.y);
+        hash.Add(it.xspeed);
+        hash.Add(it.yspeed);
+        hash.Add(it.mode);
+        hash.Add(it.t);
+      });
+      break;
+
+    case kCloners:
+      add_list(cloneur_list, [&](const Cloner& it) {  //
+        hash.Add(it.enable);
+      });
+      break;
+
+    case kArrowLaunchers:
+      add_list(arrowLauncherDetector_list,
+               [&](const ArrowLauncherDetector& it) { hash.Add(it.t); });
+      break;
+
+    case kArrows:
+      add_list(arrow_pool.active, [&](int slot) {
+        hash.Add(arrow_pool.position[slot].x);
+        hash.Add(arrow_pool.position[slot].y);
+        hash.Add(arrow_pool.speed[slot].x);
+        hash.Add(arrow_pool.speed[slot].y);
+        // Not the angle: only drawn, and from std::atan2.
+        hash.Add(arrow_pool.alpha[slot]);
+        hash.Add(int(arrow_pool.damage[slot]));
+      });
+      break;
+
+    case kParticles:
+      add_list(particule_list, [&](const Particule& it) {
+        hash.Add(it.x);
+        hash.Add(it.y);
+        hash.Add(it.alpha);
+        hash.Add(it.t);
+      });
+      break;
+
+    case kPincettes:
+      add_list(pincette_list, [&](const Pincette& it) {  //
+        hash.Add(it.step());
+      });
+      break;
+
+    case kButtons:
+      add_list(button_list, [&](const Button& it) {
+        hash.Add(it.nb_pressed);
+        hash.Add(it.isPressed);
+        hash.Add(it.t);
+      });
+      break;
+
+    case kLaserTurrets:
+      add_list(laserTurret_list, [&](const LaserTurret& it) {
+        hash.Add(it.angle);
+        hash.Add(it.angleIncrement);
+      });
+      break;
+
+    case kElectricity:
+      add_list(electricity_list, [&](const Electricity& it) {  //
+        hash.Add(it.is_active());
+      });
+      break;
+
+    case kRandom:
+      hash.Add(uint64_t(random_.Peek()));
+      break;
+
+    case kOutcome:
+      hash.Add(isWin);
+      hash.Add(isLose);
+      hash.Add(isEscape);
+      break;
+
+    case kEverything:
+      add_list(special_list, [&](const Special& it) {
+        hash.Add(it.m);
+        hash.Add(it.erased);
+        add_list(it.var, [&](int var) { hash.Add(var); });
+      });
+      break;
+  }
+  return hash.value();
+}
+
+Level::Phases& Level::Phases::operator=(const Phases&) {
+  graph.Clear();
+  spawned.clear();
+  return *this;
+}
+
+void Level::Publish(int phase, PhaseGraph::Resources resources) {
+  Spawned& spawned = phases_.spawned[phase];
+  if (resources & kParticles) {
+    for (auto& particule : spawned.particles)
+      particule_list.push_front(std::move(particule));
+    spawned.particles.clear();
+  }
+  if (resources & kSounds) {
+    for (const smk::SoundBuffer* buffer : spawned.sounds) {
+      if (audio)
+        audio->Play(*buffer);
+    }
+    for (SoundSource* sound : spawned.replayed)
+      sound->Play();
+    spawned.sounds.clear();
+    spawned.replayed.clear();
+  }
+  if (resources & kTelemetry) {
+    for (const TelemetryEvent& event : spawned.events)
+      Record(event);
+    spawned.events.clear();
+  }
+}
+
+void Level::Record(TelemetryEvent event) {
+  if (!telemetry)
+    return;
+  event.level = level_id_;
+  event.tick = time;
+  telemetry->Record(event);
+}
+
+void Level::StepHeroes(Spawned& spawned) {
   /////////////////////////////////
   //        Hero  selected       //
   /////////////////////////////////
 
   // changement de joueur
-  static bool spacepressed = false;
   if (!hero_list.empty()) {
-    if (input & Input::Space) {
-      if (spacepressed == false) {
-        spacepressed = true;
+    if (input_ & Input::Space) {
+      if (space_pressed_ == false) {
+        space_pressed_ = true;
         heroSelected = (heroSelected + 1) % nbHero;
       }
     } else
-      spacepressed = false;
+      space_pressed_ = false;
   }
 
   int i = 0;
@@ -366,13 +892,17 @@ void Level::Step(Input::T input, smk::Window& window) {
 
     if (hero.in_laser) {
       hero.life--;
+      hero.cause = DeathCause::Laser;
       hero.in_laser = false;
     }
 
     // an Hero is dead?
     if (hero.life <= 0) {
       // throw Particule (ghost))
-      particule_list.push_front(particuleDead(hero.x, hero.y));
+      spawned.particles.push_back(particuleDead(hero.x, hero.y));
+      spawned.events.push_back(TelemetryEvent{0, 0, hero.x, hero.y,
+                                              TelemetryType::Death, hero.cause});
+      sensors_.Remove(hero.sensors, sensor_events_);
 
       // we kill him
       it = hero_list.erase(it);
@@ -389,72 +919,16 @@ void Level::Step(Input::T input, smk::Window& window) {
       break;
     }
 
-    // test if there are a ground under the feets of the Hero
-    if (PlaceFree(hero, 0, 2)) {
-      // apply gravity
-      hero.yspeed += 1.7;
-
-    } else {
-      if (hero.yspeed < 0)
-        hero.yspeed = 0;
-
-      // test for un jump
-      if (i == heroSelected) {
-        if (input & Input::Up)
-          hero.yspeed = -20;
-      }
-    }
-
-    if (i == heroSelected) {
-      // move on the right
-      if (input & Input::Right) {
-        hero.sens = false;
-        hero.xspeed += 2;
-      }
-
-      // move on the left
-      if (input & Input::Left) {
-        hero.sens = true;
-        hero.xspeed -= 2;
-      }
-    }
-    // apply friction
-    hero.xspeed *= 0.75;
-    hero.yspeed *= 0.95;
-
-    // test if we can apply the speed to the position, if not we reduce it while
-    // its too high
-    if (hero.xspeed != 0) {
-      if (!PlaceFree(hero, hero.xspeed, 0)) {
-        float i = hero.xspeed;
-        while (!PlaceFree(hero, i, 0))
-          i -= Sign(hero.xspeed);
-        hero.xspeed = i;
-      }
-    }
-
-    // test if we can apply the speed to the position, if not we reduce it while
-    // its too high
-    if (hero.yspeed != 0) {
-      if (!PlaceFree(hero, 0, hero.yspeed)) {
-        float i = hero.yspeed;
-        while (!PlaceFree(hero, 0, i))
-          i -= Sign(hero.yspeed);
-        hero.yspeed = i;
-      }
-    }
-
-    hero.y += hero.yspeed;
-    hero.x += hero.xspeed;
+    if (fixed_point)
+      StepHero<Fixed>(hero, input_, i == heroSelected);
+    else
+      StepHero<float>(hero, input_, i == heroSelected);
 
-    hero.UpdateGeometry();
     ++i;
   }
+}
 
-  /////////////////////////////////
-  //        movingBlocks         //
-  /////////////////////////////////
-
+void Level::StepMovingBlocks(Spawned&) {
   for (auto& block : movBlock_list) {
     // If there is a moving block under the hero, make the hero move with the
     // block.
@@ -499,11 +973,9 @@ void Level::Step(Input::T input, smk::Window& window) {
       }
     }
   }
+}
 
-  /////////////////////////////////
-  //        FallingBlock         //
-  /////////////////////////////////
-
+void Level::StepFallingBlocks(Spawned&) {
   for (auto& it : fallBlock_list) {
     if (it.etape == 0)  // here the FallingBlock still immobile
     {
@@ -513,269 +985,103 @@ void Level::Step(Input::T input, smk::Window& window) {
     } else if (it.etape > 12)  // here it falls
     {
       it.etape++;
-      // test if there are a ground under the feets of the FallingBlock
-      if (PlaceFree(it, 0, 1)) {
-        // apply gravity
-        it.yspeed += 1.7;
-      } else {
-        it.yspeed = 0;
-      }
-
-      // apply friction
-      it.yspeed *= 0.95;
-
-      // test if we can apply the speed to the position, if not we reduce it
-      // while its too high
-      if (it.yspeed != 0) {
-        if (!PlaceFree(it, 0, it.yspeed)) {
-          float i = it.yspeed;
-          while (!PlaceFree(it, 0, i))
-            i -= Sign(it.yspeed);
-          it.yspeed = i;
-        }
-      }
-
-      it.y += it.yspeed;
-      it.UpdateGeometry();
+      if (fixed_point)
+        StepFallingBlock<Fixed>(it);
+      else
+        StepFallingBlock<float>(it);
     } else  // here it wait and shake
     {
       it.etape++;
     }
   }
+}
 
-  /////////////////////////////////
-  //        MovableBlock         //
-  /////////////////////////////////
+void Level::StepMovableBlocks(Spawned&) {
   for (auto& it : movableBlock_list) {
-    // test if there are a ground under the feets of the MovableBlock
-    if (PlaceFree(it, 0, 2)) {
-      // apply gravity
-      it.yspeed += 1.7;
-    } else {
-      it.yspeed = 0;
-    }
-
-    for (std::vector<Hero>::iterator itHero = hero_list.begin();
-         itHero != hero_list.end(); ++itHero) {
-      // move on the right
-      if (IsCollision(it.geometry.shift(-1, 0), (*itHero).geometry)) {
-        if (PlaceFree(it, +1, 0))
-          it.xspeed += 2;
-      }
-
-      // move on the left
-      if (IsCollision(it.geometry.shift(1, 0), (*itHero).geometry)) {
-        if (PlaceFree(it, -1, 0))
-          it.xspeed -= 2;
-      }
-    }
-
-    // apply friction
-    it.xspeed *= 0.4;
-    it.yspeed *= 0.95;
-
-    // test if we can apply the speed to the position, if not we reduce it while
-    // its too high
-    if (it.xspeed != 0) {
-      if (!PlaceFree(it, it.xspeed, 0)) {
-        float i = it.xspeed;
-        while (!PlaceFree(it, i, 0)) {
-          i -= Sign(it.xspeed);
-          if (i * it.xspeed <= 0) {
-            i = 0;
-            break;
-          }
-        }
-        it.xspeed = i;
-      }
-    }
-
-    // test if we can apply the speed to the position, if not we reduce it while
-    // its too high
-    if (it.yspeed != 0) {
-      if (!PlaceFree(it, 0, it.yspeed)) {
-        float i = it.yspeed;
-        while (!PlaceFree(it, 0, i)) {
-          i -= Sign(it.yspeed);
-          if (i * it.yspeed <= 0) {
-            i = 0;
-            break;
-          }
-        }
-        it.yspeed = i;
-      }
-    }
-
-    it.y += it.yspeed;
-    it.x += it.xspeed;
-    it.UpdateGeometry();
+    if (fixed_point)
+      StepPushableBlock<Fixed>(it, 2);
+    else
+      StepPushableBlock<float>(it, 2);
   }
+}
 
-  /////////////////////////////////
-  //        Glass                //
-  /////////////////////////////////
+void Level::StepGlass(Spawned&) {
   for (auto& it : glassBlock_list) {
-    // test if there are a ground under the feets of the Glass
-    if (PlaceFree(it, 0, 1)) {
-      // apply gravity
-      it.yspeed += 1.7;
-    } else {
-      it.yspeed = 0;
-    }
-
-    for (std::vector<Hero>::iterator itHero = hero_list.begin();
-         itHero != hero_list.end(); ++itHero) {
-      // move on the right
-      if (IsCollision(it.geometry.shift(-1, 0), (*itHero).geometry)) {
-        if (PlaceFree(it, +1, 0))
-          it.xspeed += 2;
-      }
-
-      // move on the left
-      if (IsCollision(it.geometry.shift(1, 0), (*itHero).geometry)) {
-        if (PlaceFree(it, -1, 0))
-          it.xspeed -= 2;
-      }
-    }
-
-    // apply friction
-    it.xspeed *= 0.4;
-    it.yspeed *= 0.95;
+    if (fixed_point)
+      StepPushableBlock<Fixed>(it, 1);
+    else
+      StepPushableBlock<float>(it, 1);
+  }
+}
 
-    // test if we can apply the speed to the position, if not we reduce it while
-    // its too high
-    if (it.xspeed != 0) {
-      if (!PlaceFree(it, it.xspeed, 0)) {
-        float i = it.xspeed;
-        while (!PlaceFree(it, i, 0)) {
-          i -= Sign(it.xspeed);
-          if (i * it.xspeed <= 0) {
-            i = 0;
-            break;
-          }
+void Level::StepSensors(Spawned&) {
+  for (auto& hero : hero_list)
+    sensors_.Update(hero.geometry, hero.sensors, sensor_events_);
+
+  if (sensors_.count(finish_sensor_))
+    isWin = true;
+
+  for (const SensorEvent& event : sensor_events_) {
+    int index = sensors_.index(event.sensor);
+    switch (sensors_.kind(event.sensor)) {
+      case SensorSystem::Detector: {
+        bool detected = sensors_.count(event.sensor) > 0;
+        if (detector_list[index].detected != detected) {
+          detector_list[index].detected = detected;
+          logic_graph_.SetDetected(index, detected);
         }
-        it.xspeed = i;
+        break;
       }
-    }
 
-    // test if we can apply the speed to the position, if not we reduce it while
-    // its too high
-    if (it.yspeed != 0) {
-      if (!PlaceFree(it, 0, it.yspeed)) {
-        float i = it.yspeed;
-        while (!PlaceFree(it, 0, i)) {
-          i -= Sign(it.yspeed);
-          if (i * it.yspeed <= 0) {
-            i = 0;
+      case SensorSystem::TextPopup:
+        if (event.type != SensorEvent::Enter)
+          break;
+        for (auto it = textpopup_list.begin(); it != textpopup_list.end();
+             ++it) {
+          if (it->sensor == event.sensor) {
+            drawn_textpopup_list.push_back(*it);
+            textpopup_list.erase(it);
             break;
           }
         }
-        it.yspeed = i;
-      }
-    }
-
-    it.y += it.yspeed;
-    it.x += it.xspeed;
-    it.UpdateGeometry();
-  }
-  /////////////////////////////////
-  //        FinishBlock          //
-  /////////////////////////////////
+        sensors_.Disable(event.sensor);
+        break;
 
-  for (std::vector<Hero>::iterator itHero = hero_list.begin();
-       itHero != hero_list.end(); ++itHero) {
-    if (IsCollision((*itHero).geometry, enddingBlock.geometry)) {
-      isWin = true;
+      default:
+        break;
     }
   }
+}
 
-  /////////////////////////////////
-  //        Detector             //
-  /////////////////////////////////
-  for (auto& it : detector_list) {
-    it.detected = false;
-    for (std::vector<Hero>::iterator itHero = hero_list.begin();
-         itHero != hero_list.end(); ++itHero) {
-      if (IsCollision((*itHero).geometry, it.geometry)) {
-        it.detected = true;
-      }
-    }
-  }
+void Level::StepPics(Spawned&) {
+  logic_graph_.Step(pic_list);
 
-  /////////////////////////////////
-  //       Pics                  //
-  /////////////////////////////////
   for (auto& it : pic_list) {
-    int nb = 0;
-    for (std::vector<int>::iterator itInt = (it.connexion).begin();
-         itInt != (it.connexion).end(); ++itInt) {
-      if (detector_list[(*itInt)].detected) {
-        nb++;
-      }
-    }
-    bool avancer = false;
-    switch (it.comparateur) {
-      case 0:
-        if (nb < it.nbRequis)
-          avancer = true;
-        break;
-      case 1:
-        if (nb == it.nbRequis)
-          avancer = true;
-        break;
-      case 2:
-        if (nb > it.nbRequis)
-          avancer = true;
-        break;
-    }
-
-    if (avancer) {
-      if (it.avancement < 32)
-        it.avancement += 2;
-    } else {
-      if (it.avancement > 0)
-        it.avancement--;
-    }
-
-    float rad = float(it.angle) * 0.0174532925;
-    float p1x = it.x + (it.avancement + 32) * cos(rad);
-    float p1y = it.y - (it.avancement + 32) * sin(rad);
-    float p2x = it.x + it.avancement * cos(rad) + 8 * cos(rad + 1.57079633);
-    float p2y = it.y - it.avancement * sin(rad) - 8 * sin(rad + 1.57079633);
-    float p3x = it.x + it.avancement * cos(rad) - 8 * cos(rad + 1.57079633);
-    float p3y = it.y - it.avancement * sin(rad) + 8 * sin(rad + 1.57079633);
-    Line l1 = {{p2x, p2y}, {p1x, p1y}};
-    Line l2 = {{p3x, p3y}, {p1x, p1y}};
-
-    for (std::vector<Hero>::iterator itHero = hero_list.begin();
-         itHero != hero_list.end(); ++itHero) {
-      if (IsCollision(itHero->geometry, l1)) {
-        itHero->life = 0;
-      } else if (IsCollision(itHero->geometry, l2)) {
-        itHero->life = 0;
+    for (auto& hero : hero_list) {
+      if (IsCollision(hero.geometry, it.l1) ||
+          IsCollision(hero.geometry, it.l2)) {
+        hero.life = 0;
+        hero.cause = DeathCause::Spike;
       }
     }
   }
+}
 
-  /////////////////////////////////
-  //        Accelerator         //
-  /////////////////////////////////
-  for (auto& it : accelerator_list) {
-    for (std::vector<Hero>::iterator itHero = hero_list.begin();
-         itHero != hero_list.end(); ++itHero) {
-      if (IsCollision((*itHero).geometry, it.geometry)) {
-        itHero->xspeed += it.xacc;
-        itHero->yspeed += it.yacc;
-        itHero->xspeed *= it.viscosite;
-        itHero->yspeed *= it.viscosite;
-      }
+void Level::StepAccelerators(Spawned&) {
+  for (auto& hero : hero_list) {
+    for (int sensor : hero.sensors) {
+      if (sensors_.kind(sensor) != SensorSystem::Accelerator)
+        continue;
+      auto& it = accelerator_list[sensors_.index(sensor)];
+      if (fixed_point)
+        Accelerate<Fixed>(hero, it);
+      else
+        Accelerate<float>(hero, it);
     }
   }
+}
 
-  /////////////////////////////////
-  //        Creepers             //
-  /////////////////////////////////
-
+void Level::StepCreepers(Spawned& spawned) {
   for (auto creeper = creeper_list.begin(); creeper != creeper_list.end();) {
     if (!CollisionWithAllBlock(Point(creeper->x + creeper->xspeed * 7, creeper->y))) {
       creeper->x += creeper->xspeed;
@@ -804,7 +1110,7 @@ void Level::Step(Input::T input, smk::Window& window) {
         creeper->mode = 0;
         creeper->t = 0;
         for (int i = 0; i <= 20; i++)
-          particule_list.push_front(particuleCreeperExplosion(creeper->x, creeper->y));
+          spawned.particles.push_back(particuleCreeperExplosion(creeper->x, creeper->y, random_));
 
         for (std::vector<Hero>::iterator itHero = hero_list.begin();
              itHero != hero_list.end(); ++itHero) {
@@ -814,28 +1120,27 @@ void Level::Step(Input::T input, smk::Window& window) {
               InRange(1500 * ((*itHero).x - creeper->x) / distance2, -20, 20);
           (*itHero).yspeed +=
               InRange(1500 * ((*itHero).y - creeper->y) / distance2, -20, 20);
-          (*itHero).life -= 3 * 10000 / int(distance2);
+          int damage = 3 * 10000 / int(distance2);
+          (*itHero).life -= damage;
+          if (damage)
+            (*itHero).cause = DeathCause::Creeper;
         }
 
-        auto explosion = smk::Sound(SB_explosion);
-        explosion.Play();
-        sound_list.push_front(std::move(explosion));
+        spawned.sounds.push_back(&SB_explosion);
         creeper = creeper_list.erase(creeper);
         continue;
       }
     }
     ++creeper;
   }
+}
 
-  /////////////////////////////////
-  //        Cloneurs             //
-  /////////////////////////////////
-
+void Level::StepCloners(Spawned& spawned) {
   for (auto& it : cloneur_list) {
     if (it.enable) {
       for (int a = 0; a <= 1; a++) {
-        particule_list.push_front(
-            particuleCloneur(it.xstart + rand() % 32, it.ystart + 32));
+        spawned.particles.push_back(
+            particuleCloneur(it.xstart + random_.Rand() % 32, it.ystart + 32));
       }
       for (std::vector<Hero>::iterator itHero = hero_list.begin();
            itHero != hero_list.end(); ++itHero) {
@@ -846,8 +1151,8 @@ void Level::Step(Input::T input, smk::Window& window) {
           nbHero++;
           // emit some particules on the end
           for (int a = 0; a <= 50; a++) {
-            particule_list.push_front(
-                particuleCloneur(it.xend + rand() % 32, it.yend + 32));
+            spawned.particles.push_back(
+                particuleCloneur(it.xend + random_.Rand() % 32, it.yend + 32));
           }
 
           break;
@@ -855,21 +1160,13 @@ void Level::Step(Input::T input, smk::Window& window) {
       }
     }
   }
-  ////////////////////////////
-  // ArrowLauncherDetector //
-  //////////////////////////
+}
 
+void Level::StepArrowLaunchers(Spawned& spawned) {
   for(auto& arrow_launcher_detector : arrowLauncherDetector_list) {
     if (arrow_launcher_detector.mode != 0) {
       if (arrow_launcher_detector.mode <= 2) {
-        bool isDetected = false;
-        for (std::vector<Hero>::iterator itHero = hero_list.begin();
-             itHero != hero_list.end(); ++itHero) {
-          if (IsCollision(arrow_launcher_detector.geometry, itHero->geometry)) {
-            isDetected = true;
-          }
-        }
-        if (isDetected) {
+        if (sensors_.count(arrow_launcher_detector.sensor)) {
           if (arrow_launcher_detector.mode == 1)
             arrow_launcher_detector.mode = 0;
           else if (arrow_launcher_detector.mode == 2)
@@ -877,11 +1174,9 @@ void Level::Step(Input::T input, smk::Window& window) {
           int i = 0;
           for (auto& arrow_launcher: arrowLauncher_list) {
             if (i == arrow_launcher_detector.launcherID) {
-              arrow_list.push_front(
-                  Arrow({arrow_launcher.x + 16, arrow_launcher.y + 16},
-                        {+17 * cos(arrow_launcher.orientation * .0174532925),
-                         -17 * sin(arrow_launcher.orientation * .0174532925)}));
-              arrow_launcher.sound.Play();
+              arrow_pool.Spawn({arrow_launcher.x + 16, arrow_launcher.y + 16},
+                               arrow_launcher.ArrowSpeed(fixed_point));
+              spawned.replayed.push_back(&arrow_launcher.sound);
             }
             i++;
           }
@@ -894,49 +1189,9 @@ void Level::Step(Input::T input, smk::Window& window) {
       }
     }
   }
+}
 
-  ////////////
-  // Arrow///
-  //////////
-  for (auto& it : arrow_list) {
-    it.Step();
-    if (it.damage) {
-      if (!CollisionWithAllBlock(it.position)) {
-        it.speed.y += 1.0;
-        it.alpha -= std::min(10, it.alpha);
-      }
-      continue;
-    }
-
-    // burst Particule
-    if (glm::length(it.speed) > 1.f)
-      particule_list.push_front(particuleArrow(it.position.x, it.position.y));
-
-    if (!CollisionWithAllBlock(it.position))
-      continue;
-
-    if (glm::length(it.speed) > 1.f) {
-      for (std::vector<Hero>::iterator itHero = hero_list.begin();
-           itHero != hero_list.end(); ++itHero) {
-        if (IsCollision(it.position, (*itHero).geometry)) {
-          itHero->life -= 100;
-          it.speed.y = 0.01;
-        }
-      }
-    }
-    it.speed.x = -0.1 * it.speed.x;
-    it.speed.y = -0.1 * it.speed.y;
-    while (CollisionWithAllBlock(it.position))
-      it.Step();
-    it.speed *= -1;
-    it.Step();
-    it.speed = {0.f, 0.f};
-    it.damage = true;
-  }
-  /////////////////////////////////
-  //        particules           //
-  /////////////////////////////////
-
+void Level::StepParticles(Spawned&) {
   for (auto particule = particule_list.begin();
        particule != particule_list.end();) {
     if (particule->Step())
@@ -944,24 +1199,31 @@ void Level::Step(Input::T input, smk::Window& window) {
     else
       ++particule;
   }
+}
 
-  // Pincette
-  for (auto& it : pincette_list) it.Step();
-  for (auto& special : special_list)
-    special.Step(*this);
-
-  ///////////////
-  // Button   //
-  /////////////
+void Level::StepPincettes(Spawned&) {
+  for (auto& pincette : pincette_list)
+    pincette.Step();
+}
 
-  for (auto& it : button_list) {
-    bool pressed = false;
-    for (std::vector<Hero>::iterator ithero = hero_list.begin();
-         ithero != hero_list.end(); ++ithero) {
-      if (IsCollision(it.geometry, ithero->geometry)) {
-        pressed = true;
-      }
+void Level::StepSpecials(Spawned& spawned) {
+  for (auto& special : special_list) {
+    special.Step(*this);
+    if (special.triggered) {
+      special.triggered = false;
+      TelemetryEvent event{0, 0, 0.f, 0.f, TelemetryType::Special};
+      event.special = special.m;
+      spawned.events.push_back(event);
     }
+  }
+}
+
+void Level::StepButtons(Spawned&) {
+  for (const SensorEvent& event : sensor_events_) {
+    if (sensors_.kind(event.sensor) != SensorSystem::Button)
+      continue;
+    auto& it = button_list[sensors_.index(event.sensor)];
+    bool pressed = sensors_.count(event.sensor) > 0;
     if (pressed) {
       if (not it.isPressed) {
         it.isPressed = true;
@@ -975,15 +1237,15 @@ void Level::Step(Input::T input, smk::Window& window) {
       }
     }
   }
+}
 
-  for (auto& pincette : pincette_list)
-    pincette.Step();
-
-  // Draw static turrets and throw out Laser
+void Level::StepLaserTurrets(Spawned&) {
   for (auto& it : laserTurret_list) {
-    it.Step();
+    it.Step(fixed_point);
   }
+}
 
+void Level::StepGlassInLaser(Spawned&) {
   for (auto it = glassBlock_list.begin(); it != glassBlock_list.end(); ++it) {
     auto& glass = *it;
     if (!glass.in_laser)
@@ -995,47 +1257,276 @@ void Level::Step(Input::T input, smk::Window& window) {
     if (glass.height <= 3)
       it = glassBlock_list.erase(it);
   }
+}
 
-  /////////////////////////////////
-  //        Teleporter           //
-  /////////////////////////////////
-  for (std::vector<Hero>::iterator itHero = hero_list.begin();
-       itHero != hero_list.end(); ++itHero) {
-    for (auto& it : teleporter_list) {
-      if (IsCollision((*itHero).geometry, it.geometry)) {
-        // teleport the Hero
-        (*itHero).x += it.xTeleport;
-        (*itHero).y += it.yTeleport;
-        (*itHero).UpdateGeometry();
-        SetView(window);
+void Level::StepTeleporters(Spawned&) {
+  for (auto& hero : hero_list) {
+    for (int sensor : hero.sensors) {
+      if (sensors_.kind(sensor) != SensorSystem::Teleporter)
+        continue;
+      // teleport the Hero
+      auto& it = teleporter_list[sensors_.index(sensor)];
+      hero.x += it.xTeleport;
+      hero.y += it.yTeleport;
+      hero.UpdateGeometry();
+      SetView();
+    }
+  }
+}
+
+void Level::StepElectricity(Spawned&) {
+  for (auto& it : electricity_list)
+    it.Step(time);
+}
+
+// collision with an Hero
+void Level::StepElectricityOnHeroes(Spawned&) {
+  for (auto& hero : hero_list) {
+    for (int sensor : hero.sensors) {
+      if (sensors_.kind(sensor) != SensorSystem::Electricity)
+        continue;
+      auto& it = electricity_list[sensors_.index(sensor)];
+      if (it.is_active() &&
+          IsCollision(hero.geometry.increase(10, 10),
+                      Line{{it.x1, it.y1}, {it.x2, it.y2}})) {
+        hero.life -= 4;
+        hero.cause = DeathCause::Electricity;
       }
     }
   }
+}
+
+// Traced after everything moved. The heroes and the glass hit are hurt on the
+// next Step.
+void Level::StepLasers(Spawned& spawned) {
+  laser_.clear();
+  for (auto& it : laserTurret_list)
+    EmitLaser(it.x, it.y, it.angle, spawned, 10);
+}
+
+void Level::BuildSensors() {
+  int i = 0;
+  for (auto& it : accelerator_list)
+    sensors_.Add(SensorSystem::Accelerator, i++, it.geometry);
+
+  i = 0;
+  for (auto& it : arrowLauncherDetector_list) {
+    it.sensor =
+        sensors_.Add(SensorSystem::ArrowLauncherDetector, i++, it.geometry);
+  }
+
+  i = 0;
+  for (auto& it : button_list)
+    sensors_.Add(SensorSystem::Button, i++, it.geometry);
+
+  i = 0;
+  for (auto& it : detector_list)
+    sensors_.Add(SensorSystem::Detector, i++, it.geometry);
+
+  // The Hero is hurt when its geometry increased by 10 touches the arc. The
+  // bounding box of the arc increased by 10 is only a first filter.
+  i = 0;
   for (auto& it : electricity_list) {
-    it.Step(time);
+    Rectangle box(std::min(it.x1, it.x2) - 10, std::max(it.x1, it.x2) + 10,
+                  std::max(it.y1, it.y2) + 10, std::min(it.y1, it.y2) - 10);
+    sensors_.Add(SensorSystem::Electricity, i++, box);
+  }
 
-    if (it.is_active()) {
-      // collision with an Hero
-      for (auto& hero : hero_list) {
-        if (IsCollision(hero.geometry.increase(10, 10),
-                        Line{{it.x1, it.y1}, {it.x2, it.y2}})) {
-          hero.life -= 4;
+  finish_sensor_ = sensors_.Add(SensorSystem::Finish, 0, enddingBlock.geometry);
+
+  i = 0;
+  for (auto& it : teleporter_list)
+    sensors_.Add(SensorSystem::Teleporter, i++, it.geometry);
+
+  i = 0;
+  for (auto& it : textpopup_list)
+    it.sensor = sensors_.Add(SensorSystem::TextPopup, i++, it.geometry);
+
+  sensors_.Build();
+}
+
+// The physics below is written once for float, and once for Fixed when
+// |fixed_point| is set. With float, it computes exactly what it always did.
+template <typename Real>
+void Level::StepHero(Hero& hero, Input::T input, bool selected) {
+  Real xspeed = hero.xspeed;
+  Real yspeed = hero.yspeed;
+
+  // test if there are a ground under the feets of the Hero
+  if (PlaceFree(hero, 0, 2)) {
+    // apply gravity
+    yspeed += 1.7;
+
+  } else {
+    if (yspeed < 0)
+      yspeed = 0;
+
+    // test for un jump
+    if (selected) {
+      if (input & Input::Up)
+        yspeed = -20;
+    }
+  }
+
+  if (selected) {
+    // move on the right
+    if (input & Input::Right) {
+      hero.sens = false;
+      xspeed += 2;
+    }
+
+    // move on the left
+    if (input & Input::Left) {
+      hero.sens = true;
+      xspeed -= 2;
+    }
+  }
+  // apply friction
+  xspeed *= 0.75;
+  yspeed *= 0.95;
+
+  // test if we can apply the speed to the position, if not we reduce it while
+  // its too high
+  if (xspeed != 0) {
+    if (!PlaceFree(hero, float(xspeed), 0)) {
+      Real i = xspeed;
+      while (!PlaceFree(hero, float(i), 0))
+        i -= Sign(float(xspeed));
+      xspeed = i;
+    }
+  }
+
+  // test if we can apply the speed to the position, if not we reduce it while
+  // its too high
+  if (yspeed != 0) {
+    if (!PlaceFree(hero, 0, float(yspeed))) {
+      Real i = yspeed;
+      while (!PlaceFree(hero, 0, float(i)))
+        i -= Sign(float(yspeed));
+      yspeed = i;
+    }
+  }
+
+  hero.y = float(Real(hero.y) + yspeed);
+  hero.x = float(Real(hero.x) + xspeed);
+  hero.xspeed = float(xspeed);
+  hero.yspeed = float(yspeed);
+
+  hero.UpdateGeometry();
+}
+
+template <typename Real>
+void Level::StepFallingBlock(FallingBlock& it) {
+  Real yspeed = it.yspeed;
+
+  // test if there are a ground under the feets of the FallingBlock
+  if (PlaceFree(it, 0, 1)) {
+    // apply gravity
+    yspeed += 1.7;
+  } else {
+    yspeed = 0;
+  }
+
+  // apply friction
+  yspeed *= 0.95;
+
+  // test if we can apply the speed to the position, if not we reduce it
+  // while its too high
+  if (yspeed != 0) {
+    if (!PlaceFree(it, 0, float(yspeed))) {
+      Real i = yspeed;
+      while (!PlaceFree(it, 0, float(i)))
+        i -= Sign(float(yspeed));
+      yspeed = i;
+    }
+  }
+
+  it.y = float(Real(it.y) + yspeed);
+  it.yspeed = float(yspeed);
+  it.UpdateGeometry();
+}
+
+// A MovableBlock or a Glass.
+template <typename Real, typename Block>
+void Level::StepPushableBlock(Block& it, int ground_distance) {
+  Real xspeed = it.xspeed;
+  Real yspeed = it.yspeed;
+
+  // test if there are a ground under the feets of the block
+  if (PlaceFree(it, 0, ground_distance)) {
+    // apply gravity
+    yspeed += 1.7;
+  } else {
+    yspeed = 0;
+  }
+
+  for (auto& hero : hero_list) {
+    // move on the right
+    if (IsCollision(it.geometry.shift(-1, 0), hero.geometry)) {
+      if (PlaceFree(it, +1, 0))
+        xspeed += 2;
+    }
+
+    // move on the left
+    if (IsCollision(it.geometry.shift(1, 0), hero.geometry)) {
+      if (PlaceFree(it, -1, 0))
+        xspeed -= 2;
+    }
+  }
+
+  // apply friction
+  xspeed *= 0.4;
+  yspeed *= 0.95;
+
+  // test if we can apply the speed to the position, if not we reduce it while
+  // its too high
+  if (xspeed != 0) {
+    if (!PlaceFree(it, float(xspeed), 0)) {
+      Real i = xspeed;
+      while (!PlaceFree(it, float(i), 0)) {
+        i -= Sign(float(xspeed));
+        if (i * xspeed <= 0) {
+          i = 0;
+          break;
         }
       }
+      xspeed = i;
     }
   }
 
-  // TextPopup.
-  for (auto it = textpopup_list.begin(); it != textpopup_list.end();) {
-    for (auto& hero : hero_list) {
-      if (IsCollision(it->geometry, hero.geometry)) {
-        drawn_textpopup_list.push_back(*it);
-        it = textpopup_list.erase(it);
-      } else {
-        ++it;
+  // test if we can apply the speed to the position, if not we reduce it while
+  // its too high
+  if (yspeed != 0) {
+    if (!PlaceFree(it, 0, float(yspeed))) {
+      Real i = yspeed;
+      while (!PlaceFree(it, 0, float(i))) {
+        i -= Sign(float(yspeed));
+        if (i * yspeed <= 0) {
+          i = 0;
+          break;
+        }
       }
+      yspeed = i;
     }
   }
+
+  it.y = float(Real(it.y) + yspeed);
+  it.x = float(Real(it.x) + xspeed);
+  it.xspeed = float(xspeed);
+  it.yspeed = float(yspeed);
+  it.UpdateGeometry();
+}
+
+template <typename Real>
+void Level::Accelerate(Hero& hero, const Accelerator& accelerator) {
+  Real xspeed = hero.xspeed;
+  Real yspeed = hero.yspeed;
+  xspeed += accelerator.xacc;
+  yspeed += accelerator.yacc;
+  xspeed *= accelerator.viscosite;
+  yspeed *= accelerator.viscosite;
+  hero.xspeed = float(xspeed);
+  hero.yspeed = float(yspeed);
 }
 
 bool Level::CollisionWithAllBlock(Rectangle geom) {
@@ -1049,9 +1540,8 @@ bool Level::CollisionWithAllBlock(Rectangle geom) {
 }
 
 bool Level::CollisionWithAllBlock(Point p) {
+  if (static_blocks_.Contains(p)) return true;
   for (auto& it : hero_list)         if (IsCollision(p, it.geometry)) return true;
-  for (auto& it : block_list)        if (IsCollision(p, it.geometry)) return true;
-  for (auto& it : invBlock_list)     if (IsCollision(p, it.geometry)) return true;
   for (auto& it : movBlock_list)     if (IsCollision(p, it.geometry)) return true;
   for (auto& it : fallBlock_list)    if (IsCollision(p, it.geometry)) return true;
   for (auto& it : movableBlock_list) if (IsCollision(p, it.geometry)) return true;
@@ -1062,8 +1552,7 @@ bool Level::CollisionWithAllBlock(Point p) {
 bool Level::PlaceFree(const Hero& h, float x, float y) {
   Rectangle shifted = h.geometry.shift(x,y);
   // clang-format off
-  for (auto& it : block_list)        if (IsCollision(shifted, it.geometry)) return false;
-  for (auto& it : invBlock_list)     if (IsCollision(shifted, it.geometry)) return false;
+  if (static_boxes_.AnyCollision(shifted)) return false;
   for (auto& it : movBlock_list)     if (IsCollision(shifted, it.geometry)) return false;
   for (auto& it : fallBlock_list)    if (IsCollision(shifted, it.geometry)) return false;
   for (auto& it : movableBlock_list) if (IsCollision(shifted, it.geometry)) return false;
@@ -1075,8 +1564,7 @@ bool Level::PlaceFree(const Hero& h, float x, float y) {
 
 bool Level::PlaceFree(const MovingBlock& m, float x, float y) {
   Rectangle geom = m.geometry.shift(x,y);
-  for (auto& it : block_list)        if (IsCollision(geom, it.geometry)) return false;
-  for (auto& it : invBlock_list)     if (IsCollision(geom, it.geometry)) return false;
+  if (static_boxes_.AnyCollision(geom)) return false;
   for (auto& it : fallBlock_list)    if (IsCollision(geom, it.geometry)) return false;
   for (auto& it : movableBlock_list) if (IsCollision(geom, it.geometry)) return false;
   for (auto& it : hero_list)         if (IsCollision(geom, it.geometry)) return false;
@@ -1088,8 +1576,7 @@ bool Level::PlaceFree(const MovingBlock& m, float x, float y) {
 bool Level::PlaceFree(const FallingBlock& m, float x, float y) {
   Rectangle geom = m.geometry.shift(x, y);
   // clang-format off
-  for (auto& it : block_list)        if (IsCollision(geom, it.geometry)) return false;
-  for (auto& it : invBlock_list)     if (IsCollision(geom, it.geometry)) return false;
+  if (static_boxes_.AnyCollision(geom)) return false;
   for (auto& it : movBlock_list)     if (IsCollision(geom, it.geometry)) return false;
   for (auto& it : movableBlock_list) if (IsCollision(geom, it.geometry)) return false;
   for (auto& it : glassBlock_list)   if (IsCollision(geom, it.geometry)) return false;
@@ -1102,8 +1589,7 @@ bool Level::PlaceFree(const FallingBlock& m, float x, float y) {
 bool Level::PlaceFree(const MovableBlock& m, float x, float y) {
   Rectangle geom = m.geometry.shift(x, y);
   // clang-format off
-  for (auto& it : block_list)        if (IsCollision(geom, it.geometry)) return false;
-  for (auto& it : invBlock_list)     if (IsCollision(geom, it.geometry)) return false;
+  if (static_boxes_.AnyCollision(geom)) return false;
   for (auto& it : movBlock_list)     if (IsCollision(geom, it.geometry)) return false;
   for (auto& it : fallBlock_list)    if (IsCollision(geom, it.geometry)) return false;
   for (auto& it : glassBlock_list)   if (IsCollision(geom, it.geometry)) return false;
@@ -1117,8 +1603,7 @@ bool Level::PlaceFree(const MovableBlock& m, float x, float y) {
 bool Level::PlaceFree(const Glass& m, float x, float y) {
   Rectangle geom = m.geometry.shift(x, y);
   // clang-format off
-  for (auto& it : block_list)        if (IsCollision(geom, it.geometry)) return false;
-  for (auto& it : invBlock_list)     if (IsCollision(geom, it.geometry)) return false;
+  if (static_boxes_.AnyCollision(geom)) return false;
   for (auto& it : movBlock_list)     if (IsCollision(geom, it.geometry)) return false;
   for (auto& it : movableBlock_list) if (IsCollision(geom, it.geometry)) return false;
   for (auto& it : fallBlock_list)    if (IsCollision(geom, it.geometry)) return false;
@@ -1142,64 +1627,137 @@ bool Level::CollisionWithAllBlock(Line l) {
   // clang-format on
 }
 
-void Level::EmitLaser(smk::Window& window,
-                  float x,
-                  float y,
-                  float angle,
-                  int recursiveMaxLevel) {
-  if (recursiveMaxLevel <= 0)
-    return;
-  float a = angle * 0.0174532925;
-  int max = 1000;
-  static int i = 0;
-  float l = max;
-  float xx = x + 2*cos(a);
-  float yy = y - 2*sin(a);
-
-  // Draw the Laser
-  while (l > 0.5) {
-    float xxx = xx + l * cos(a);
-    float yyy = yy - l * sin(a);
-    if (!CollisionWithAllBlock(Line{{xx, yy},{ xxx, yyy}})) {
-      for (int r = 1; r <= 4; r += 1) {
-        auto line = smk::Shape::Line({xx, yy}, {xxx, yyy}, r);
-        line.SetColor(glm::vec4(0.2, 0, 0, 0));
-        line.SetBlendMode(smk::BlendMode::Add);
-        window.Draw(line);
+void Level::StepArrows(Spawned& spawned) {
+  ArrowPool& arrows = arrow_pool;
+
+  // Move every arrow at once. Arrows never interact with each other, so the
+  // per-arrow logic below can see the whole batch already moved.
+  for (int slot : arrows.active)
+    arrows.position[slot] += arrows.speed[slot];
+
+  for (int slot : arrows.active) {
+    glm::vec2& position = arrows.position[slot];
+    glm::vec2& speed = arrows.speed[slot];
+
+    if (arrows.damage[slot]) {
+      if (!CollisionWithAllBlock(position)) {
+        speed.y += 1.0;
+        arrows.alpha[slot] -= std::min(10, arrows.alpha[slot]);
+      }
+      continue;
+    }
+
+    // burst Particule
+    if (glm::length(speed) > 1.f)
+      spawned.particles.push_back(particuleArrow(position.x, position.y, random_));
+
+    if (!CollisionWithAllBlock(position))
+      continue;
+
+    if (glm::length(speed) > 1.f) {
+      for (auto& hero : hero_list) {
+        if (IsCollision(position, hero.geometry)) {
+          hero.life -= 100;
+          hero.cause = DeathCause::Arrow;
+          speed.y = 0.01;
+        }
       }
-      xx = xxx;
-      yy = yyy;
     }
-    l /= 2;
+    speed.x = -0.1 * speed.x;
+    speed.y = -0.1 * speed.y;
+    while (CollisionWithAllBlock(position))
+      position += speed;
+    speed *= -1;
+    position += speed;
+    speed = {0.f, 0.f};
+    arrows.damage[slot] = true;
   }
 
+  // Recycle the arrows that faded out, and the ones that left the level for
+  // good.
+  Rectangle bounds = static_blocks_.bounds().increase(512, 512);
+  arrows.Retire([&](int slot) {
+    if (arrows.damage[slot] && arrows.alpha[slot] == 0)
+      return true;
+    return !static_blocks_.empty() &&
+           !IsCollision(arrows.position[slot], bounds);
+  });
+}
 
-  // we move on more Step
-  xx = xx + 1 * cos(a);
-  yy = yy - 1 * sin(a);
+// The end of the beam, traced like EmitLaser does with float, but in Fixed
+// with table based sines. Every point of the trace is on the Fixed grid.
+glm::vec2 Level::TraceLaser(float x, float y, int angle) {
+  Fixed cos_a = CosDegrees(angle);
+  Fixed sin_a = SinDegrees(angle);
+  Fixed fx = Fixed(x) + 2 * cos_a;
+  Fixed fy = Fixed(y) - 2 * sin_a;
+  for (Fixed l = 1000; l > Fixed(0.5f); l *= Fixed(0.5f)) {
+    Fixed fxx = fx + l * cos_a;
+    Fixed fyy = fy - l * sin_a;
+    Line step{{float(fx), float(fy)}, {float(fxx), float(fyy)}};
+    if (!CollisionWithAllBlock(step)) {
+      fx = fxx;
+      fy = fyy;
+    }
+  }
+  return {float(fx + cos_a), float(fy - sin_a)};
+}
+
+void Level::EmitLaser(float x,
+                      float y,
+                      int angle,
+                      Spawned& spawned,
+                      int recursiveMaxLevel) {
+  if (recursiveMaxLevel <= 0)
+    return;
+  float xx, yy;
+  if (fixed_point) {
+    glm::vec2 end = TraceLaser(x, y, angle);
+    xx = end.x;
+    yy = end.y;
+  } else {
+    float a = angle * 0.0174532925;
+    int max = 1000;
+    float l = max;
+    xx = x + 2*cos(a);
+    yy = y - 2*sin(a);
+
+    // Trace the Laser
+    while (l > 0.5) {
+      float xxx = xx + l * cos(a);
+      float yyy = yy - l * sin(a);
+      if (!CollisionWithAllBlock(Line{{xx, yy},{ xxx, yyy}})) {
+        xx = xxx;
+        yy = yyy;
+      }
+      l /= 2;
+    }
+
+    // we move on more Step
+    xx = xx + 1 * cos(a);
+    yy = yy - 1 * sin(a);
+  }
 
   laser_.push_back(Laser{glm::vec2(x, y), glm::vec2(xx, yy)});
 
   // checking impact of the Laser with the Hero
-  i = 0;
   for (auto& it : hero_list) {
     if (IsCollision(Point(xx, yy), it.geometry.increase(4, 4))) {
-      particule_list.push_front(particuleLaserOnHero(xx, yy, x, y));
-      particule_list.push_front(particuleLaserOnHero(xx, yy, x, y));
-      particule_list.push_front(particuleLaserOnHero(xx, yy, x, y));
-      particule_list.push_front(particuleLaserOnHero(xx, yy, x, y));
+      spawned.particles.push_back(particuleLaserOnHero(xx, yy, x, y, random_));
+      spawned.particles.push_back(particuleLaserOnHero(xx, yy, x, y, random_));
+      spawned.particles.push_back(particuleLaserOnHero(xx, yy, x, y, random_));
+      spawned.particles.push_back(particuleLaserOnHero(xx, yy, x, y, random_));
       it.in_laser = true;
     }
-    i++;
   }
   // checking impact of the Laser with Glass
   for (auto it = glassBlock_list.begin(); it != glassBlock_list.end(); ++it) {
     auto& glass = *it;
     if (IsCollision(Point(xx, yy), glass.geometry.increase(5, 5))) {
-      particule_list.push_front(particuleLaserOnGlass(xx, yy, x, y));
-      particule_list.push_front(particuleLaserOnGlass(xx, yy, x, y));
-      particule_list.push_front(particuleLaserOnGlass(xx, yy, x, y));
-      particule_list.push_front(particuleLaserOnGlass(xx, yy, x, y));
+      spawned.particles.push_back(particuleLaserOnGlass(xx, yy, x, y, random_));
+      spawned.particles.push_back(particuleLaserOnGlass(xx, yy, x, y, random_));
+      spawned.particles.push_back(particuleLaserOnGlass(xx, yy, x, y, random_));
+      spawned.particles.push_back(particuleLaserOnGlass(xx, yy, x, y, random_));
 
       glass.in_laser = true;
     }
@@ -1208,13 +1766,13 @@ void Level::EmitLaser(smk::Window& window,
   // checking impact of the Laser with StaticMirror
   for (auto& it : staticMiroir_list) {
     if (IsCollision(Rectangle(xx - 5, xx + 5, yy - 5, yy + 5), it.geometry)) {
-      EmitLaser(window, xx, yy, 2 * it.angle - angle,
-            recursiveMaxLevel - 1);  // throw reflection
+      EmitLaser(xx, yy, 2 * it.angle - angle, spawned,
+                recursiveMaxLevel - 1);  // throw reflection
     }
   }
 }
 
-void Level::SetView(smk::Window& window) {
+void Level::SetView() {
   if (!hero_list.empty()) {
     auto geometry = hero_list[heroSelected].geometry;
     if (fluidViewEnable) {
@@ -1231,6 +1789,23 @@ void Level::SetView(smk::Window& window) {
     view_.SetCenter(xcenter, ycenter);
   }
 
-  (void)window;
   view_.SetSize(640,480);
 }
+
+void Level::UpdateSounds() {
+  glm::vec2 center(xcenter, ycenter);
+  for (auto& it : arrowLauncher_list) {
+    glm::vec2 position(it.x + 16, it.y + 16);
+    it.sound.Update(glm::length(position - center), audio);
+  }
+
+  // From the closest point of the arc.
+  for (auto& it : electricity_list) {
+    glm::vec2 a(it.x1, it.y1);
+    glm::vec2 ab = glm::vec2(it.x2, it.y2) - a;
+    float length = glm::dot(ab, ab);
+    float t = length > 0.f ? glm::dot(center - a, ab) / length : 0.f;
+    glm::vec2 closest = a + std::clamp(t, 0.f, 1.f) * ab;
+    it.sound.Update(glm::length(closest - center), audio);
+  }
+}
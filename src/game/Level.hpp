@@ -2,46 +2,63 @@
 #define GAME_LEVEL_HPP
 
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include <smk/Sound.hpp>
 #include <smk/View.hpp>
-#include <smk/Window.hpp>
 #include "game/Accelerator.hpp"
-#include "game/Arrow.hpp"
 #include "game/ArrowLauncher.hpp"
 #include "game/ArrowLauncherDetector.hpp"
+#include "game/ArrowPool.hpp"
+#include "game/AudioThread.hpp"
 #include "game/Block.hpp"
+#include "game/BoxBatch.hpp"
 #include "game/Button.hpp"
 #include "game/Cloner.hpp"
 #include "game/Collision.hpp"
 #include "game/Creeper.hpp"
 #include "game/Decor.hpp"
 #include "game/Detector.hpp"
+#include "game/DrawList.hpp"
 #include "game/Electricity.hpp"
 #include "game/FallingBlock.hpp"
 #include "game/FinishBlock.hpp"
 #include "game/Forme.hpp"
+#include "game/Ghost.hpp"
 #include "game/Glass.hpp"
 #include "game/Hero.hpp"
 #include "game/InvisibleBlock.hpp"
+#include "game/JobSystem.hpp"
 #include "game/Laser.hpp"
+#include "game/LogicGraph.hpp"
 #include "game/LaserTurret.hpp"
+#include "game/LineBatch.hpp"
 #include "game/MovableBlock.hpp"
 #include "game/MovingBlock.hpp"
 #include "game/Particule.hpp"
 #include "game/Pic.hpp"
+#include "game/PhaseGraph.hpp"
 #include "game/Pincette.hpp"
+#include "game/Random.hpp"
+#include "game/Resource.hpp"
+#include "game/Sensor.hpp"
+#include "game/SoundSource.hpp"
 #include "game/Special.hpp"
+#include "game/StaticGrid.hpp"
+#include "game/StateHash.hpp"
 #include "game/StaticMirror.hpp"
+#include "game/Telemetry.hpp"
 #include "game/Teleporter.hpp"
 #include "game/TextPopup.hpp"
+#include "game/TiledBackground.hpp"
 
 struct Input {
   enum T {
@@ -52,41 +69,111 @@ struct Input {
     Space = 8,
     Escape = 16,
     Restart = 32,
+    Next = 64,  // Skip to the next TextPopup page.
   };
 };
 
 class Level {
  public:
   Level() = default;
+  // |seed| drives every random choice of the simulation.
+  explicit Level(int seed) : random_(seed) {}
   ~Level() = default;
 
-  // 1. Populate the level with objects.
+  // A copy evolves on its own, from the same state. The sounds being played
+  // are not copied.
+  Level(const Level&) = default;
+  Level& operator=(const Level&) = default;
+  Level(Level&&) = default;
+  Level& operator=(Level&&) = default;
+
+  // Simulate with Fixed and table based trigonometry instead of float and
+  // std::sin: the heroes, the falling, movable and moving blocks, the glass,
+  // the accelerators, the turrets, the direction of the arrows and the trace
+  // of the laser beams. Set before LoadFromFile. Their state is then the same
+  // on every build.
+  //
+  // Still float:
+  // - the motion of the arrows once thrown, the creepers, and the test of a
+  //   laser step against the blocks (a cross product). They only add and
+  //   multiply, which gives the same result wherever float math follows IEEE
+  //   single precision (SSE, wasm), but not always with x87 or fused
+  //   multiply-adds.
+  // - the specials, the particles and the drawn angle of the arrows. They
+  //   call std::sin and std::atan2, so they can also differ with the C
+  //   library.
+  bool fixed_point = false;
+
+  // Run the independent phases of Step on these threads. Without, they run
+  // in order on the calling thread. The result is the same.
+  JobSystem* job_system = nullptr;
+
+  // Where the sounds are played. Silent without. Not owned.
+  AudioThread::Queue* audio = nullptr;
+
+  // Where the gameplay events go. Not owned.
+  Telemetry* telemetry = nullptr;
+  // Send |event| to the telemetry, from the level at this tick.
+  void Record(TelemetryEvent event);
+
+  // Drawn with the heroes, at the current tick. Not owned.
+  std::vector<GhostReader*> ghosts;
+
+  // 1. Populate the level with objects. Makes no GL call: the objects only
+  // refer to their textures, and their sprites are built when drawn. The
+  // tools load levels without a window or a GL context.
   void LoadFromFile(std::string fileName);
 
-  // 2. Advance in the simulation. 30 times per secondes.
-  void Step(Input::T input, smk::Window& window);
+  // 2. Advance in the simulation. 30 times per secondes. Makes no GL call
+  // either: LevelScreen runs it on another thread while a frame is shown.
+  void Step(Input::T input);
 
   // 3. Draw the current state of the level.
-  void Draw(smk::Window& window);
+  void Draw(DrawList& target);
+
+  // Apply the edits of the level file to the running level. The heroes, the
+  // time, and the objects whose line is unchanged keep their state. The
+  // others are added, removed or reset as written in the file.
+  void Reload(const std::string& fileName);
 
   // Output:
   bool isPrevious = false;
   bool isWin = false;
   bool isLose = false;
   bool isEscape = false;
+  const smk::SoundBuffer& music() const { return *music_; }
+
+  // For the tools exploring the level, like the solver:
+  // - The distance from the closest hero to the finish block.
+  float DistanceToFinish() const;
+  // - The position of the heroes and of the moving parts of the level,
+  //   rounded to |cell| pixels. The speed of the heroes too.
+  uint64_t PositionKey(float cell) const;
+
+  // Hash of the whole simulation state. Two runs of the same level with the
+  // same inputs must agree at every tick. Computed when asked, so the game
+  // doesn't pay for it: only the parts of the resources written by the Steps
+  // since the previous call are hashed again. A special may write every
+  // resource, so with one, a call costs a hash of the whole state. Not thread
+  // safe.
+  uint64_t state_hash() const;
+
+  // Steps simulated, not counting the ones paused by a text popup.
+  int ticks() const { return time; }
+  // The selected hero, to be recorded in a ghost.
+  GhostSample ghost_sample() const;
 
  private:
   friend Special;
-  std::list<Accelerator> accelerator_list;
-  std::list<Arrow> arrow_list;
-  std::list<Button> button_list;
   std::list<Particule> particule_list;
   std::list<Special> special_list;
   std::list<TextPopup> textpopup_list;
   std::list<TextPopup> drawn_textpopup_list;
+  std::vector<Accelerator> accelerator_list;
   std::vector<ArrowLauncher> arrowLauncher_list;
   std::vector<ArrowLauncherDetector> arrowLauncherDetector_list;
   std::vector<Block> block_list;
+  std::vector<Button> button_list;
   std::vector<Cloner> cloneur_list;
   std::vector<Creeper> creeper_list;
   std::vector<Decor> decorBack_list;
@@ -104,23 +191,114 @@ class Level {
   std::vector<StaticMirror> staticMiroir_list;
   std::vector<Teleporter> teleporter_list;
   std::vector<Hero> hero_list;
+  ArrowPool arrow_pool;
 
   FinishBlock enddingBlock;
 
-  smk::Sprite spriteBackground;
   int heroSelected = 0;
   int nbHero = 0;
   bool fluidViewEnable = true;
   int time = 0;
   int timeDead = 0;
 
-  std::list<smk::Sound> sound_list;
+  const smk::SoundBuffer* music_ = &SB_backgroundMusic;
+
+  // Everything random in the simulation comes from |random_|. Cosmetic
+  // randomness in Draw comes from |draw_random_|, so that drawing doesn't
+  // change the simulation.
+  Random random_;
+  Random draw_random_;
+
+  bool space_pressed_ = false;
 
   // View view;
   float xcenter, ycenter;
   float viewXMin, viewYMin, viewXMax, viewYMax;
   smk::View view_;
-  void SetView(smk::Window& window);
+  void SetView();
+  void UpdateSounds();  // Attenuated by their distance to the view center.
+
+  // Blocks and invisible blocks never move. They are indexed once loaded.
+  StaticGrid static_blocks_;  // For points.
+  BoxBatch static_boxes_;     // For rectangles.
+
+  // Trigger volumes, registered once loaded. Heroes report Enter/Exit events.
+  SensorSystem sensors_;
+  std::vector<SensorEvent> sensor_events_;
+  int finish_sensor_ = 0;
+  void BuildSensors();
+
+  // Detectors -> Pics.
+  LogicGraph logic_graph_;
+
+  // The lines of the level file, by identifier.
+  std::map<std::string, std::vector<std::string>> source_;
+
+  // What a phase of Step spawned, merged into the level by Publish.
+  struct Spawned {
+    std::vector<Particule> particles;
+    std::vector<const smk::SoundBuffer*> sounds;
+    std::vector<SoundSource*> replayed;
+    std::vector<TelemetryEvent> events;
+  };
+
+  // The phases refer to this instance. A copy of the level starts without,
+  // and builds its own on its first Step.
+  struct Phases {
+    PhaseGraph graph;
+    std::vector<Spawned> spawned;
+
+    Phases() = default;
+    Phases(const Phases&) {}
+    Phases& operator=(const Phases&);
+  };
+  Phases phases_;
+  Input::T input_ = Input::None;
+  void BuildPhases();
+  void Publish(int phase, PhaseGraph::Resources resources);
+  uint32_t level_id_ = 0;  // For the telemetry.
+
+  // The state hash is made of one part per resource. Step only records the
+  // resources it may have written, and state_hash() recomputes their parts.
+  mutable std::vector<uint64_t> state_parts_;
+  mutable PhaseGraph::Resources state_written_ = ~PhaseGraph::Resources(0);
+  void InvalidateStateHash(PhaseGraph::Resources written) {
+    state_written_ |= written;
+  }
+  uint64_t HashPart(PhaseGraph::Resources resource) const;
+
+  // The phases, in order.
+  void StepHeroes(Spawned& spawned);
+  void StepMovingBlocks(Spawned& spawned);
+  void StepFallingBlocks(Spawned& spawned);
+  void StepMovableBlocks(Spawned& spawned);
+  void StepGlass(Spawned& spawned);
+  void StepSensors(Spawned& spawned);
+  void StepPics(Spawned& spawned);
+  void StepAccelerators(Spawned& spawned);
+  void StepCreepers(Spawned& spawned);
+  void StepCloners(Spawned& spawned);
+  void StepArrowLaunchers(Spawned& spawned);
+  void StepArrows(Spawned& spawned);
+  void StepParticles(Spawned& spawned);
+  void StepPincettes(Spawned& spawned);
+  void StepSpecials(Spawned& spawned);
+  void StepButtons(Spawned& spawned);
+  void StepLaserTurrets(Spawned& spawned);
+  void StepGlassInLaser(Spawned& spawned);
+  void StepTeleporters(Spawned& spawned);
+  void StepElectricity(Spawned& spawned);
+  void StepElectricityOnHeroes(Spawned& spawned);
+  void StepLasers(Spawned& spawned);
+
+  template <typename Real>
+  void StepHero(Hero& hero, Input::T input, bool selected);
+  template <typename Real>
+  void StepFallingBlock(FallingBlock& block);
+  template <typename Real, typename Block>
+  void StepPushableBlock(Block& block, int ground_distance);
+  template <typename Real>
+  void Accelerate(Hero& hero, const Accelerator& accelerator);
 
   bool CollisionWithAllBlock(Rectangle geom);
   bool CollisionWithAllBlock(Line l);
@@ -131,11 +309,28 @@ class Level {
   bool PlaceFree(const MovableBlock& m, float x, float y);
   bool PlaceFree(const Glass& m, float x, float y);
 
-  void EmitLaser(smk::Window& window,
-                 float x,
+  TiledBackground background_{img_background};
+
+  // Lines drawn in one call per batch.
+  LineBatch tether_lines_{LineBatch::Solid, {0.f, 0.f, 0.f, 1.f},
+                          smk::BlendMode::Alpha};
+  LineBatch electricity_glow_{LineBatch::Glow,
+                              glm::vec4(242, 224, 58, 80) / 255.f,
+                              smk::BlendMode::Add};
+  LineBatch electricity_core_{LineBatch::Solid,
+                              glm::vec4(252, 234, 68, 255) / 255.f,
+                              smk::BlendMode::Alpha};
+  LineBatch laser_core_{LineBatch::Solid, {1.f, 0.f, 0.f, 1.f},
+                        smk::BlendMode::Alpha};
+  LineBatch laser_glow_{LineBatch::Glow, {1.f, 0.f, 0.f, 0.6f},
+                        smk::BlendMode::Add};
+
+  void EmitLaser(float x,
                  float y,
-                 float angle,
+                 int angle,
+                 Spawned& spawned,
                  int recursiveMaxLevel = 30);
+  glm::vec2 TraceLaser(float x, float y, int angle);  // With fixed_point.
   std::list<Laser> laser_;
 };
 
@@ -0,0 +1,61 @@
+#include "game/LevelPreloader.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace {
+
+#if defined(__EMSCRIPTEN__)
+// Without threads, the level loads when it is taken.
+const std::launch kLoadLaunch = std::launch::deferred;
+#else
+const std::launch kLoadLaunch = std::launch::async;
+#endif
+
+Level Load(std::string fileName) {
+  Level level;
+  level.LoadFromFile(fileName);
+  return level;
+}
+
+Level Copy(std::shared_ptr<const Level> level) {
+  return *level;
+}
+
+bool Running(const std::future<Level>& future) {
+  return future.valid() &&
+         future.wait_for(std::chrono::seconds(0)) ==
+             std::future_status::timeout;
+}
+
+}  // namespace
+
+void LevelPreloader::Replace(Pending& pending, Pending by) {
+  abandoned_.erase(
+      std::remove_if(abandoned_.begin(), abandoned_.end(),
+                     [](auto& future) { return !Running(future); }),
+      abandoned_.end());
+  if (Running(pending.level))
+    abandoned_.push_back(std::move(pending.level));
+  pending = std::move(by);
+}
+
+void LevelPreloader::Preload(const std::string& fileName) {
+  if (next_.Is(fileName) || (fresh_ && restart_.file_name == fileName))
+    return;
+  Replace(next_, {fileName, std::async(kLoadLaunch, Load, fileName)});
+}
+
+Level LevelPreloader::Take(const std::string& fileName) {
+  bool edited = fresh_file_ && fresh_file_->Changed();
+  if (restart_.Is(fileName) && !edited) {
+    Level level = restart_.level.get();
+    restart_.level = std::async(kLoadLaunch, Copy, fresh_);
+    return level;
+  }
+
+  Level level = next_.Is(fileName) ? next_.level.get() : Load(fileName);
+  fresh_ = std::make_shared<const Level>(level);
+  fresh_file_ = std::make_unique<FileWatcher>(fileName);
+  Replace(restart_, {fileName, std::async(kLoadLaunch, Copy, fresh_)});
+  return level;
+}
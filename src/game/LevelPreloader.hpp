@@ -0,0 +1,44 @@
+#ifndef GAME_LEVEL_PRELOADER_HPP
+#define GAME_LEVEL_PRELOADER_HPP
+
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+#include "game/FileWatcher.hpp"
+#include "game/Level.hpp"
+
+// Loads the level likely to be played next on another thread, while the
+// current one is played. Loading a level makes no GL call.
+class LevelPreloader {
+ public:
+  // Start loading |fileName|, replacing the level preloaded before. Nothing
+  // to do when it is already loading, or is the level taken last.
+  void Preload(const std::string& fileName);
+
+  // The level loaded from |fileName|. Loaded now, unless it was preloaded.
+  // Taking the same level again, to restart it, returns a copy of it as it
+  // was loaded, made in the background. Unless its file was written since.
+  Level Take(const std::string& fileName);
+
+ private:
+  struct Pending {
+    std::string file_name;
+    std::future<Level> level;
+    bool Is(const std::string& fileName) const {
+      return level.valid() && file_name == fileName;
+    }
+  };
+
+  // Replace |pending|. The future of std::async waits for the load when
+  // destroyed: a load still running is kept until it completes.
+  void Replace(Pending& pending, Pending by);
+
+  Pending next_;
+  Pending restart_;  // A copy of |fresh_|.
+  std::shared_ptr<const Level> fresh_;  // The level taken last, as loaded.
+  std::unique_ptr<FileWatcher> fresh_file_;
+  std::vector<std::future<Level>> abandoned_;
+};
+
+#endif /* GAME_LEVEL_PRELOADER_HPP */
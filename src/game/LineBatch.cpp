@@ -0,0 +1,58 @@
+#include "game/LineBatch.hpp"
+#include <cmath>
+#include <cstdint>
+#include <smk/Texture.hpp>
+#include <smk/VertexArray.hpp>
+
+namespace {
+
+// A white texture. Its alpha falls off across the line: the texture_position
+// goes from 0 to 1 across the thickness.
+const smk::Texture& GlowTexture() {
+  static smk::Texture texture = [] {
+    const int size = 64;
+    std::vector<uint8_t> data;
+    for (int y = 0; y < size; ++y) {
+      float u = std::abs(2.f * (y + 0.5f) / size - 1.f);
+      float alpha = (1.f - u) * (1.f - u) * (1.f - u) * (1.f - u);
+      data.insert(data.end(), {255, 255, 255, uint8_t(255 * alpha)});
+    }
+    return smk::Texture(data.data(), 1, size);
+  }();
+  return texture;
+}
+
+}  // namespace
+
+LineBatch::LineBatch(Style style, glm::vec4 color, smk::BlendMode blend_mode)
+    : style_(style) {
+  transformable_.SetColor(color);
+  transformable_.SetBlendMode(blend_mode);
+}
+
+// Same triangles as smk::Shape::Line.
+void LineBatch::Add(glm::vec2 a, glm::vec2 b, float thickness) {
+  if (a == b)
+    return;
+  glm::vec2 dt =
+      glm::normalize(glm::vec2(b.y - a.y, a.x - b.x)) * thickness * 0.5f;
+  vertices_.push_back({a + dt, {0.f, 0.f}});
+  vertices_.push_back({b + dt, {0.f, 0.f}});
+  vertices_.push_back({b - dt, {0.f, 1.f}});
+  vertices_.push_back({a + dt, {0.f, 0.f}});
+  vertices_.push_back({b - dt, {0.f, 1.f}});
+  vertices_.push_back({a - dt, {0.f, 1.f}});
+}
+
+void LineBatch::Draw(DrawList& target) {
+  if (vertices_.empty())
+    return;
+
+  // The texture is created once a GL context exists.
+  if (style_ == Glow)
+    transformable_.SetTexture(GlowTexture());
+
+  transformable_.SetVertexArray(smk::VertexArray(vertices_));
+  target.Draw(transformable_);
+  vertices_.clear();
+}
@@ -0,0 +1,34 @@
+#ifndef GAME_LINE_BATCH_HPP
+#define GAME_LINE_BATCH_HPP
+
+#include <smk/BlendMode.hpp>
+#include <smk/Transformable.hpp>
+#include <smk/Vertex.hpp>
+#include <vector>
+#include "game/DrawList.hpp"
+
+// Thick segments sharing a color and a blend mode. They are appended during a
+// frame, and drawn at once in a single call.
+class LineBatch {
+ public:
+  enum Style {
+    Solid,
+    // The alpha falls off smoothly from the center to the edges. A single
+    // wide glow line replaces several overdrawn ones.
+    Glow,
+  };
+
+  LineBatch(Style style, glm::vec4 color, smk::BlendMode blend_mode);
+
+  void Add(glm::vec2 a, glm::vec2 b, float thickness);
+
+  // Draw every segment added since the last Draw.
+  void Draw(DrawList& target);
+
+ private:
+  Style style_;
+  std::vector<smk::Vertex2D> vertices_;
+  smk::Transformable transformable_;
+};
+
+#endif /* GAME_LINE_BATCH_HPP */
@@ -0,0 +1,65 @@
+#include "game/LogicGraph.hpp"
+#include "game/Pic.hpp"
+
+void LogicGraph::Build(int detector_count, const std::vector<Pic>& pic_list) {
+  int pic_count = pic_list.size();
+  listener_start_.assign(detector_count + 1, 0);
+  nb_detected_.assign(pic_count, 0);
+  is_dirty_.assign(pic_count, false);
+  dirty_.clear();
+
+  // A Pic can list the same Detector several times. It then counts several
+  // times, so it is listed several times.
+  auto valid = [&](int detector) {
+    return detector >= 0 && detector < detector_count;
+  };
+  for (const Pic& pic : pic_list) {
+    for (int detector : pic.connexion) {
+      if (valid(detector))
+        listener_start_[detector + 1]++;
+    }
+  }
+
+  for (int i = 1; i <= detector_count; ++i)
+    listener_start_[i] += listener_start_[i - 1];
+
+  listener_.resize(listener_start_.back());
+  std::vector<int> fill(listener_start_.begin(), listener_start_.end() - 1);
+  for (int i = 0; i < pic_count; ++i) {
+    for (int detector : pic_list[i].connexion) {
+      if (valid(detector))
+        listener_[fill[detector]++] = i;
+    }
+  }
+
+  // The initial position depends on nothing having been detected yet.
+  for (int i = 0; i < pic_count; ++i)
+    MarkDirty(i);
+}
+
+void LogicGraph::SetDetected(int detector, bool detected) {
+  int delta = detected ? +1 : -1;
+  for (int i = listener_start_[detector]; i < listener_start_[detector + 1];
+       ++i) {
+    nb_detected_[listener_[i]] += delta;
+    MarkDirty(listener_[i]);
+  }
+}
+
+void LogicGraph::MarkDirty(int pic) {
+  if (is_dirty_[pic])
+    return;
+  is_dirty_[pic] = true;
+  dirty_.push_back(pic);
+}
+
+void LogicGraph::Step(std::vector<Pic>& pic_list) {
+  next_dirty_.clear();
+  for (int i : dirty_) {
+    if (pic_list[i].Step(nb_detected_[i]))
+      next_dirty_.push_back(i);
+    else
+      is_dirty_[i] = false;
+  }
+  dirty_.swap(next_dirty_);
+}
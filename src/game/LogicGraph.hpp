@@ -0,0 +1,38 @@
+#ifndef GAME_LOGIC_GRAPH_HPP
+#define GAME_LOGIC_GRAPH_HPP
+
+#include <vector>
+
+class Pic;
+
+// The wiring between the Detectors and the Pics, compiled once the level is
+// loaded. A Detector changing state only touches the Pics listening to it, and
+// only the Pics still moving are stepped.
+class LogicGraph {
+ public:
+  void Build(int detector_count, const std::vector<Pic>& pic_list);
+
+  // Call only when the state of |detector| changes.
+  void SetDetected(int detector, bool detected);
+
+  // Move the Pics whose input changed or which didn't reach their position.
+  void Step(std::vector<Pic>& pic_list);
+
+ private:
+  // Pics listening to detector d are:
+  // listener_[listener_start_[d] ... listener_start_[d + 1]]
+  std::vector<int> listener_start_;
+  std::vector<int> listener_;
+
+  // Number of detected connexions, per Pic.
+  std::vector<int> nb_detected_;
+
+  // Pics to step, without duplicates.
+  std::vector<int> dirty_;
+  std::vector<char> is_dirty_;
+  std::vector<int> next_dirty_;
+
+  void MarkDirty(int pic);
+};
+
+#endif /* GAME_LOGIC_GRAPH_HPP */
@@ -1,7 +1,12 @@
 #include "game/MovableBlock.hpp"
 #include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
 #include <smk/Window.hpp>
 
+namespace {
+const SpriteTemplate kMovableBlock(img_block1);
+}  // namespace
+
 MovableBlock::MovableBlock(int X, int Y) {
   x = X;
   y = Y;
@@ -11,17 +16,14 @@ MovableBlock::MovableBlock(int X, int Y) {
   geometry.top = Y;
   geometry.right = X + 31;
   geometry.bottom = Y + 31;
-  sprite = smk::Sprite(img_block1);
-  sprite.SetPosition(X, Y);
 }
 void MovableBlock::UpdateGeometry() {
   geometry.left = x;
   geometry.top = y;
   geometry.right = x + 31;
   geometry.bottom = y + 31;
-  sprite.SetPosition(x, y);
 }
 
-void MovableBlock::Draw(smk::Window& window) {
-  window.Draw(sprite);
+void MovableBlock::Draw(DrawList& target) {
+  target.Draw(kMovableBlock.At(x, y));
 }
@@ -1,8 +1,8 @@
 #ifndef GAME_MOVABLE_BLOCK_HPP
 #define GAME_MOVABLE_BLOCK_HPP
 
+#include "game/DrawList.hpp"
 #include "game/Forme.hpp"
-#include <smk/Sprite.hpp>
 
 namespace smk {
 class Window;
@@ -11,12 +11,11 @@ class Window;
 class MovableBlock {
  public:
   Rectangle geometry;
-  smk::Sprite sprite;
   float x, y, xspeed, yspeed;
 
   MovableBlock(int x, int y);
   void UpdateGeometry();
-  void Draw(smk::Window& window);
+  void Draw(DrawList& target);
 };
 
 #endif /* GAME_MOVABLE_BLOCK_HPP */
@@ -1,6 +1,11 @@
 #include "MovingBlock.hpp"
 #include <smk/Window.hpp>
 #include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
+
+namespace {
+const SpriteTemplate kMovingBlock(img_block3);
+}  // namespace
 
 MovingBlock::MovingBlock(int X,
                          int Y,
@@ -8,8 +13,6 @@ MovingBlock::MovingBlock(int X,
                          int HEIGHT,
                          float XSPEED,
                          float YSPEED) {
-  sprite = smk::Sprite(img_block3);
-  sprite.SetPosition(X, Y);
   geometry.left = X;
   geometry.top = Y;
   geometry.right = X + WIDTH - 1;
@@ -20,7 +23,6 @@ MovingBlock::MovingBlock(int X,
   yspeed = YSPEED;
   width = WIDTH;
   height = HEIGHT;
-  sprite.SetScale(1, 1);
   if (WIDTH == 32 and HEIGHT == 32) {
     tiled = false;
   } else if (WIDTH % 32 == 0 and HEIGHT % 32 == 0) {
@@ -29,23 +31,23 @@ MovingBlock::MovingBlock(int X,
     ytile = HEIGHT / 32;
   } else {
     tiled = false;
-    sprite.SetScale(float(WIDTH - 1) / 31.0, float(HEIGHT - 1) / 31.0);
   }
 }
 
-void MovingBlock::Draw(smk::Window& window) {
+void MovingBlock::Draw(DrawList& target) {
   if (tiled) {
     int x = geometry.left;
     int y = geometry.top;
     int a, b;
     for (a = 0; a < xtile; a++) {
-      for (b = 0; b < ytile; b++) {
-        sprite.SetPosition(x + 32 * a, y + 32 * b);
-        window.Draw(sprite);
-      }
+      for (b = 0; b < ytile; b++)
+        target.Draw(kMovingBlock.At(x + 32 * a, y + 32 * b));
     }
-  } else
-    window.Draw(sprite);
+  } else {
+    auto sprite = kMovingBlock.At(x, y);
+    sprite.SetScale((width - 1) / 31.f, (height - 1) / 31.f);
+    target.Draw(sprite);
+  }
 }
 
 void MovingBlock::UpdateGeometry() {
@@ -53,5 +55,4 @@ void MovingBlock::UpdateGeometry() {
   geometry.right = x + width - 1;
   geometry.top = y;
   geometry.bottom = y + height - 1;
-  sprite.SetPosition(x, y);
 }
@@ -1,8 +1,8 @@
 #ifndef GAME_MOVING_BLOCK_HPP
 #define GAME_MOVING_BLOCK_HPP
 
+#include "game/DrawList.hpp"
 #include "game/Forme.hpp"
-#include <smk/Sprite.hpp>
 namespace smk {
 class Window;
 }  // namespace smk
@@ -10,7 +10,6 @@ class Window;
 class MovingBlock {
  public:
   Rectangle geometry;
-  smk::Sprite sprite;
   int xtile, ytile;
   bool tiled;
   float x, y;
@@ -21,7 +20,7 @@ class MovingBlock {
 
   MovingBlock(int X, int Y, int WIDTH, int HEIGHT, float XSPEED, float YSPEED);
   void UpdateGeometry();
-  void Draw(smk::Window& window);
+  void Draw(DrawList& target);
 };
 
 #endif /* GAME_MOVING_BLOCK_HPP */
@@ -2,6 +2,28 @@
 #include <smk/Window.hpp>
 #include <cstdlib>
 #include <cmath>
+#include "game/Resource.hpp"
+
+namespace {
+
+void Add(smk::Sprite& sprite) {
+  sprite.SetBlendMode(smk::BlendMode::Add);
+}
+
+// clang-format off
+const SpriteTemplate kSmoothRound(img_particule_smoothRound, [](smk::Sprite& s) { s.SetCenter(16, 16); Add(s); });
+const SpriteTemplate kFire(img_particule_fire, [](smk::Sprite& s) { s.SetCenter(8, 8); s.SetScale(2, 2); Add(s); });
+const SpriteTemplate kSpark(img_particule_etincelles, [](smk::Sprite& s) { s.SetCenter(3, 3); Add(s); });
+const SpriteTemplate kLargeSpark(img_particule_etincelles, [](smk::Sprite& s) { s.SetCenter(3, 3); s.SetScale(2, 2); Add(s); });
+const SpriteTemplate kExplosion(img_particule_explosion, [](smk::Sprite& s) { s.SetCenter(16, 16); s.SetScale(2, 2); Add(s); });
+const SpriteTemplate kArrowTrace(img_particule_arrow);
+const SpriteTemplate kDead(img_hero_left);
+const SpriteTemplate kPixel(img_particule_pixel, [](smk::Sprite& s) { s.SetCenter(1, 1); });
+const SpriteTemplate kWind(img_particule_line);
+const SpriteTemplate kAcc(img_particule_p, [](smk::Sprite& s) { s.SetCenter(16, 4); Add(s); });
+// clang-format on
+
+}  // namespace
 
 Particule::Particule(bool (*stepF)(Particule*)) {
   transform = stepF;
@@ -11,28 +33,34 @@ bool Particule::Step() {
   return transform(this);
 }
 
-void Particule::Draw(smk::Window& window) {
-  window.Draw(sprite);
+void Particule::Draw(DrawList& target) {
+  if (!kind)
+    return;
+  auto sprite = kind->At(x, y);
+  sprite.SetRotation(rotation);
+  sprite.SetColor(color);
+  target.Draw(sprite);
 }
 
-Particule essai() {
+Particule essai(Random& random) {
   Particule p(essaiStep);
-  p.sprite = smk::Sprite(img_particule_smoothRound);
-  p.sprite.SetCenter(16, 16);
-  p.sprite.SetPosition(200, 200);
-  p.xspeed = rand() % 11 - 5;
-  p.yspeed = rand() % 11 - 5;
-  p.sprite.SetBlendMode(smk::BlendMode::Add);
+  p.random = Random(random());
+  p.kind = &kSmoothRound;
+  p.x = 200;
+  p.y = 200;
+  p.xspeed = random.Rand() % 11 - 5;
+  p.yspeed = random.Rand() % 11 - 5;
   p.t = 0;
   p.alpha = 255;
   return p;
 }
 
 bool essaiStep(Particule* p) {
-  p->sprite.Move(p->xspeed, p->yspeed);
-  p->sprite.Rotate(1 + rand() % 3);
+  p->x += p->xspeed;
+  p->y += p->yspeed;
+  p->rotation += 1 + p->random.Rand() % 3;
   p->alpha *= 0.95;
-  p->sprite.SetColor(glm::vec4(255, p->alpha, p->alpha / 2, p->alpha) / 255.f);
+  p->color = glm::vec4(255, p->alpha, p->alpha / 2, p->alpha) / 255.f;
   p->xspeed += p->yspeed / 200;
   p->yspeed -= p->xspeed / 200;
   p->xspeed *= 0.7;
@@ -42,25 +70,25 @@ bool essaiStep(Particule* p) {
 }
 
 // fire
-Particule fireParticule(int x, int y) {
+Particule fireParticule(int x, int y, Random& random) {
   Particule p(fireParticuleStep);
-  p.sprite = smk::Sprite(img_particule_fire);
-  p.sprite.SetCenter(8, 8);
-  p.sprite.SetScale(2, 2);
-  p.sprite.SetPosition(x, y);
-  p.xspeed = rand() % 6 - 2;
-  p.yspeed = rand() % 6 - 2;
-  p.sprite.SetBlendMode(smk::BlendMode::Add);
+  p.random = Random(random());
+  p.kind = &kFire;
+  p.x = x;
+  p.y = y;
+  p.xspeed = random.Rand() % 6 - 2;
+  p.yspeed = random.Rand() % 6 - 2;
   p.t = 0;
   p.alpha = 255;
   return p;
 }
 
 bool fireParticuleStep(Particule* p) {
-  p->sprite.Move(p->xspeed, p->yspeed);
-  p->sprite.Rotate(1 + rand() % 3);
+  p->x += p->xspeed;
+  p->y += p->yspeed;
+  p->rotation += 1 + p->random.Rand() % 3;
   p->alpha *= 0.9;
-  p->sprite.SetColor(glm::vec4(255, p->alpha, p->alpha / 2, p->alpha) / 255.f);
+  p->color = glm::vec4(255, p->alpha, p->alpha / 2, p->alpha) / 255.f;
   p->xspeed += p->yspeed / 200;
   p->yspeed -= p->xspeed / 200;
   p->xspeed *= 0.3;
@@ -73,57 +101,64 @@ float square(float x) {
   return x * x;
 }
 
-Particule particuleLaserOnHero(int x, int y, int xstart, int ystart) {
+Particule particuleLaserOnHero(int x,
+                              int y,
+                              int xstart,
+                              int ystart,
+                              Random& random) {
   Particule p(particuleLaserOnHeroStep);
-  p.sprite = smk::Sprite(img_particule_etincelles);
-  p.sprite.SetCenter(3, 3);
-  p.sprite.SetPosition(x, y);
+  p.kind = &kSpark;
+  p.x = x;
+  p.y = y;
 
   float normalisation = std::sqrt(square(x - xstart) + square(y - ystart)) / 5;
   p.xspeed = (xstart - x) / normalisation;
   p.yspeed = (ystart - y) / normalisation;
 
-  p.xspeed += rand() % 4 - 1;
-  p.yspeed += rand() % 4 - 1;
-  p.sprite.SetBlendMode(smk::BlendMode::Add);
+  p.xspeed += random.Rand() % 4 - 1;
+  p.yspeed += random.Rand() % 4 - 1;
   p.t = 0;
   p.alpha = 255;
   return p;
 }
 bool particuleLaserOnHeroStep(Particule* p) {
-  p->sprite.Move(p->xspeed, p->yspeed);
-  p->sprite.SetRotation(atan2(-p->yspeed, p->xspeed) * 57 - 90);
+  p->x += p->xspeed;
+  p->y += p->yspeed;
+  p->rotation = atan2(-p->yspeed, p->xspeed) * 57 - 90;
   p->alpha *= 0.9;
-  p->sprite.SetColor(glm::vec4(200, 100, 10, p->alpha) / 255.f);
+  p->color = glm::vec4(200, 100, 10, p->alpha) / 255.f;
   p->yspeed += 0.2;
   p->t++;
   return (p->t > 60);
 }
 
-Particule particuleLaserOnGlass(int x, int y, int xstart, int ystart) {
+Particule particuleLaserOnGlass(int x,
+                               int y,
+                               int xstart,
+                               int ystart,
+                               Random& random) {
   Particule p(particuleLaserOnGlassStep);
-  p.sprite = smk::Sprite(img_particule_etincelles);
-  p.sprite.SetCenter(3, 3);
-  p.sprite.SetPosition(x, y);
-  p.sprite.SetScale(2, 2);
+  p.kind = &kLargeSpark;
+  p.x = x;
+  p.y = y;
 
   float normalisation = sqrt(square(x - xstart) + square(y - ystart)) / 3;
   p.xspeed = (xstart - x) / normalisation;
   p.yspeed = (ystart - y) / normalisation;
 
-  p.xspeed += rand() % 3 - 1;
-  p.yspeed += rand() % 3 - 1;
-  p.sprite.SetBlendMode(smk::BlendMode::Add);
+  p.xspeed += random.Rand() % 3 - 1;
+  p.yspeed += random.Rand() % 3 - 1;
   p.t = 0;
   p.alpha = 200;
   p.Step();
   return p;
 }
 bool particuleLaserOnGlassStep(Particule* p) {
-  p->sprite.Move(p->xspeed, p->yspeed);
-  p->sprite.SetRotation(atan2(-p->yspeed, p->xspeed) * 57 - 90);
+  p->x += p->xspeed;
+  p->y += p->yspeed;
+  p->rotation = atan2(-p->yspeed, p->xspeed) * 57 - 90;
   p->alpha *= 0.8;
-  p->sprite.SetColor(glm::vec4(40, 80, 255, p->alpha)/255.f);
+  p->color = glm::vec4(40, 80, 255, p->alpha)/255.f;
   p->yspeed += 0.2;
   p->xspeed *= 0.8;
   p->t++;
@@ -132,15 +167,13 @@ bool particuleLaserOnGlassStep(Particule* p) {
 
 Particule particuleCloneur(int x, int y) {
   Particule p(particuleCloneurStep);
-  p.sprite = smk::Sprite(img_particule_etincelles);
-  p.sprite.SetCenter(3, 3);
-  p.sprite.SetPosition(x, y - 9);
-  p.sprite.SetScale(2, 2);
+  p.kind = &kLargeSpark;
+  p.x = x;
+  p.y = y - 9;
 
   p.xspeed = 0;
   p.yspeed = -2;
 
-  p.sprite.SetBlendMode(smk::BlendMode::Add);
   p.t = 0;
   p.alpha = 200;
   p.Step();
@@ -148,26 +181,24 @@ Particule particuleCloneur(int x, int y) {
 }
 
 bool particuleCloneurStep(Particule* p) {
-  p->sprite.Move(p->xspeed, p->yspeed);
-  p->sprite.SetRotation(atan2(-p->yspeed, p->xspeed) * 57 - 90);
+  p->x += p->xspeed;
+  p->y += p->yspeed;
+  p->rotation = atan2(-p->yspeed, p->xspeed) * 57 - 90;
   p->alpha *= 0.8;
-  p->sprite.SetColor(glm::vec4(40, 80, 255, p->alpha) / 255.f);
+  p->color = glm::vec4(40, 80, 255, p->alpha) / 255.f;
   p->t++;
   return (p->t > 20);
 }
 
-Particule particuleCreeperExplosion(int x, int y) {
+Particule particuleCreeperExplosion(int x, int y, Random& random) {
   Particule p(particuleCreeperExplosionStep);
-  p.sprite = smk::Sprite(img_particule_explosion);
-  p.sprite.SetCenter(16, 16);
-  p.sprite.SetScale(2, 2);
-  p.sprite.SetPosition(x, y + 5);
+  p.kind = &kExplosion;
+  p.x = x;
+  p.y = y + 5;
 
-  p.xspeed = float((rand() % 10 - 5));
-  p.yspeed = float((rand() % 10 - 5));
-  ;
+  p.xspeed = float((random.Rand() % 10 - 5));
+  p.yspeed = float((random.Rand() % 10 - 5));
 
-  p.sprite.SetBlendMode(smk::BlendMode::Add);
   p.t = 0;
   p.alpha = 200;
   p.Step();
@@ -177,23 +208,22 @@ bool particuleCreeperExplosionStep(Particule* p) {
   p->xspeed *= 0.9;
   p->yspeed *= 0.9;
 
-  p->sprite.Move(p->xspeed, p->yspeed);
-  p->sprite.SetRotation(p->t);
+  p->x += p->xspeed;
+  p->y += p->yspeed;
+  p->rotation = p->t;
   p->alpha *= 0.95;
-  p->sprite.SetColor(glm::vec4(255, p->alpha, p->alpha / 2, p->alpha) / 255.f);
+  p->color = glm::vec4(255, p->alpha, p->alpha / 2, p->alpha) / 255.f;
   p->t++;
   return (p->alpha < 0.1);
 }
 
 // arrowTrace
-Particule particuleArrow(int x, int y) {
+Particule particuleArrow(int x, int y, Random& random) {
   Particule p(particuleArrowStep);
-  p.sprite.SetCenter(3, 3);
-  p.sprite = smk::Sprite(img_particule_arrow);
-  p.sprite.SetPosition(x, y);
+  p.kind = &kArrowTrace;
   p.alpha = 100;
-  p.xspeed = float((rand() % 10 - 5)) / 3.0;
-  p.yspeed = float((rand() % 10 - 5)) / 3.0;
+  p.xspeed = float((random.Rand() % 10 - 5)) / 3.0;
+  p.yspeed = float((random.Rand() % 10 - 5)) / 3.0;
   p.x = x;
   p.y = y;
 
@@ -203,17 +233,15 @@ bool particuleArrowStep(Particule* p) {
   p->x += p->xspeed;
   p->y += p->yspeed;
   p->alpha -= 10;
-  p->sprite.SetPosition(p->x, p->y);
-  p->sprite.SetColor(glm::vec4(155, 155, 155, p->alpha) / 255.f);
-  p->sprite.Rotate(10);
+  p->color = glm::vec4(155, 155, 155, p->alpha) / 255.f;
+  p->rotation += 10;
   return (p->alpha < 10);
 }
 
 // deadParticule
 Particule particuleDead(int x, int y) {
   Particule p(particuleDeadStep);
-  p.sprite = smk::Sprite(img_hero_left);
-  p.sprite.SetPosition(x, y);
+  p.kind = &kDead;
   p.alpha = 255;
   p.xspeed = 0;
   p.yspeed = -4;
@@ -227,19 +255,16 @@ bool particuleDeadStep(Particule* p) {
   p->x += p->xspeed;
   p->y += p->yspeed;
   p->alpha -= 7;
-  p->sprite.SetPosition(p->x, p->y);
-  p->sprite.SetColor(glm::vec4(155, 155, 155, p->alpha) / 255.f);
+  p->color = glm::vec4(155, 155, 155, p->alpha) / 255.f;
   return (p->alpha < 1);
 }
 
 // arbreBossParticule
-Particule arbreBossParticule(int x, int y, glm::vec4 c) {
+Particule arbreBossParticule(int x, int y, glm::vec4 c, Random& random) {
   Particule p(arbreBossParticuleStep);
-  p.sprite = smk::Sprite(img_particule_pixel);
-  p.sprite.SetPosition(x, y);
-  p.sprite.SetCenter(1, 1);
-  p.sprite.SetScale(1, 1);
-  p.sprite.SetColor(c);
+  p.random = Random(random());
+  p.kind = &kPixel;
+  p.color = c;
   p.alpha = 255;
   p.xspeed = 0;
   p.yspeed = 0;
@@ -249,47 +274,40 @@ Particule arbreBossParticule(int x, int y, glm::vec4 c) {
   return p;
 }
 bool arbreBossParticuleStep(Particule* p) {
-  p->yspeed += float(rand() % 11 - 5) / 25.0 + p->xspeed * 0.002;
-  p->xspeed += float(rand() % 11 - 5) / 25.0 - p->yspeed * 0.002;
-  p->x += p->xspeed + float(rand() % 11 - 5) / 25.0;
-  p->y += p->yspeed + float(rand() % 11 - 5) / 25;
-  p->alpha -= rand() % 2;
-  p->sprite.SetPosition(p->x, p->y);
+  p->yspeed += float(p->random.Rand() % 11 - 5) / 25.0 + p->xspeed * 0.002;
+  p->xspeed += float(p->random.Rand() % 11 - 5) / 25.0 - p->yspeed * 0.002;
+  p->x += p->xspeed + float(p->random.Rand() % 11 - 5) / 25.0;
+  p->y += p->yspeed + float(p->random.Rand() % 11 - 5) / 25;
+  p->alpha -= p->random.Rand() % 2;
   return (p->alpha < 1);
 }
 // arrowTrace
-Particule particuleWind(int x, int y) {
+Particule particuleWind(int x, int y, Random& random) {
   Particule p(particuleWindStep);
-  p.sprite.SetScale(0.3, 5.0);
-  p.sprite = smk::Sprite(img_particule_line);
-  p.sprite.SetPosition(x, y);
+  p.kind = &kWind;
   p.alpha = 120;
-  p.xspeed = float((rand() % 10 - 5)) / 3.0;
-  p.yspeed = -12 + float((rand() % 10 - 5)) / 3.0;
+  p.xspeed = float((random.Rand() % 10 - 5)) / 3.0;
+  p.yspeed = -12 + float((random.Rand() % 10 - 5)) / 3.0;
   p.x = x;
   p.y = y;
-  p.sprite.Rotate(rand() % 11 - 5);
+  p.rotation = random.Rand() % 11 - 5;
   return p;
 }
 bool particuleWindStep(Particule* p) {
   p->x += p->xspeed;
   p->y += p->yspeed;
   p->alpha -= 10;
-  p->sprite.SetPosition(p->x, p->y);
-  p->sprite.SetColor(glm::vec4(155, 155, 155, p->alpha) / 255.f);
+  p->color = glm::vec4(155, 155, 155, p->alpha) / 255.f;
   return (p->alpha < 10);
 }
 
 // acc
 Particule accParticule(int x, int y, float xspeed, int t) {
   Particule p(accParticuleStep);
-  p.sprite = smk::Sprite(img_particule_p);
-  p.sprite.SetColor(glm::vec4(255, 255, 255, 50) / 255.f);
-  p.sprite.SetCenter(16, 4);
-  p.sprite.SetPosition(x, y);
+  p.kind = &kAcc;
+  p.color = glm::vec4(255, 255, 255, 50) / 255.f;
   p.xspeed = xspeed;
   p.yspeed = 0.0;
-  p.sprite.SetBlendMode(smk::BlendMode::Add);
   p.x = x;
   p.y = y;
   p.t = t;
@@ -302,6 +320,5 @@ bool accParticuleStep(Particule* p) {
   p->y -= 2.0;
   p->x += p->xspeed;
   p->t--;
-  p->sprite.SetPosition(p->x, p->y);
   return (p->t < 1);
 }
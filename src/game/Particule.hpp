@@ -1,42 +1,55 @@
 #ifndef GAME_PARTICULE_HPP
 #define GAME_PARTICULE_HPP
 
+#include "game/DrawList.hpp"
 #include "game/Hero.hpp"
-#include <smk/Sprite.hpp>
+#include "game/Random.hpp"
+#include "game/SpriteTemplate.hpp"
 
 class window;
 
 class Particule {
  public:
-  smk::Sprite sprite;
+  const SpriteTemplate* kind = nullptr;
   bool (*transform)(Particule*);
-  float xspeed, yspeed;
-  float x, y;
-  float alpha;
-  int t;
+  float xspeed = 0.f, yspeed = 0.f;
+  float x = 0.f, y = 0.f;
+  float rotation = 0.f;
+  glm::vec4 color = {1.f, 1.f, 1.f, 1.f};
+  float alpha = 255.f;
+  int t = 0;
+  Random random;
   Particule(bool (*stepF)(Particule*));
   bool Step();
-  void Draw(smk::Window& window);
+  void Draw(DrawList& target);
 };
 
 // particules fonctions
-Particule essai();
+Particule essai(Random& random);
 bool essaiStep(Particule* p);
 
 // fire
-Particule fireParticule(int x, int y);
+Particule fireParticule(int x, int y, Random& random);
 bool fireParticuleStep(Particule* p);
 
 // laser on hero Particule
-Particule particuleLaserOnHero(int x, int y, int xstart, int ystart);
+Particule particuleLaserOnHero(int x,
+                              int y,
+                              int xstart,
+                              int ystart,
+                              Random& random);
 bool particuleLaserOnHeroStep(Particule* p);
 
 // laser on glass Particule
-Particule particuleLaserOnGlass(int x, int y, int xstart, int ystart);
+Particule particuleLaserOnGlass(int x,
+                               int y,
+                               int xstart,
+                               int ystart,
+                               Random& random);
 bool particuleLaserOnGlassStep(Particule* p);
 
 // creeper explosion
-Particule particuleCreeperExplosion(int x, int y);
+Particule particuleCreeperExplosion(int x, int y, Random& random);
 bool particuleCreeperExplosionStep(Particule* p);
 
 // cloneur
@@ -44,11 +57,11 @@ Particule particuleCloneur(int x, int y);
 bool particuleCloneurStep(Particule* p);
 
 // arrowTrace
-Particule particuleArrow(int x, int y);
+Particule particuleArrow(int x, int y, Random& random);
 bool particuleArrowStep(Particule* p);
 
 // wind
-Particule particuleWind(int x, int y);
+Particule particuleWind(int x, int y, Random& random);
 bool particuleWindStep(Particule* p);
 
 // deadParticule
@@ -56,7 +69,7 @@ Particule particuleDead(int x, int y);
 bool particuleDeadStep(Particule* p);
 
 // arbreBossParticule
-Particule arbreBossParticule(int x, int y, glm::vec4 c);
+Particule arbreBossParticule(int x, int y, glm::vec4 c, Random& random);
 bool arbreBossParticuleStep(Particule* p);
 
 // acc
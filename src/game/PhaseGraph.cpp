@@ -0,0 +1,94 @@
+#include "game/PhaseGraph.hpp"
+
+#include <algorithm>
+#include "game/JobSystem.hpp"
+
+void PhaseGraph::Clear() {
+  phases_.clear();
+  waves_.clear();
+  pending_.clear();
+}
+
+int PhaseGraph::Add(const char* name,
+                    Resources reads,
+                    Resources writes,
+                    Resources appends,
+                    Function function) {
+  phases_.push_back({name, reads, writes, appends, std::move(function)});
+  return phases_.size() - 1;
+}
+
+PhaseGraph::Resources PhaseGraph::writes() const {
+  Resources writes = 0;
+  for (const Phase& phase : phases_)
+    writes |= phase.writes | phase.appends;
+  return writes;
+}
+
+// static
+bool PhaseGraph::Conflict(const Phase& before, const Phase& after) {
+  Resources before_uses = before.reads | before.writes;
+  Resources after_uses = after.reads | after.writes;
+  return (before.writes & (after_uses | after.appends)) ||
+         (after.writes & (before_uses | before.appends)) ||
+         (before.appends & after_uses) ||  //
+         (after.appends & before_uses);
+}
+
+void PhaseGraph::Build() {
+  // Longest path from the start of the tick to each phase.
+  std::vector<int> wave(phases_.size(), 0);
+  waves_.clear();
+  for (size_t i = 0; i < phases_.size(); ++i) {
+    for (size_t j = 0; j < i; ++j) {
+      if (Conflict(phases_[j], phases_[i]))
+        wave[i] = std::max(wave[i], wave[j] + 1);
+    }
+    if (wave[i] >= (int)waves_.size())
+      waves_.resize(wave[i] + 1);
+    waves_[wave[i]].push_back(i);
+  }
+  pending_.assign(phases_.size(), 0);
+}
+
+void PhaseGraph::MergeBefore(const Phase& phase, const Merge& merge) {
+  Resources uses = phase.reads | phase.writes;
+  for (size_t i = 0; i < pending_.size(); ++i) {
+    if (pending_[i] & uses) {
+      merge(i, pending_[i] & uses);
+      pending_[i] &= ~uses;
+    }
+  }
+}
+
+void PhaseGraph::Run(JobSystem* jobs, const Merge& merge) {
+  if (!jobs) {
+    for (size_t i = 0; i < phases_.size(); ++i) {
+      MergeBefore(phases_[i], merge);
+      phases_[i].function(i);
+      pending_[i] = phases_[i].appends;
+    }
+  } else {
+    std::vector<std::function<void()>> batch;
+    for (const auto& wave : waves_) {
+      // Every appending phase conflicting with this wave is done: it belongs
+      // to a previous wave.
+      for (int i : wave)
+        MergeBefore(phases_[i], merge);
+
+      batch.clear();
+      for (int i : wave)
+        batch.push_back([this, i] { phases_[i].function(i); });
+      jobs->Run(batch);
+
+      for (int i : wave)
+        pending_[i] = phases_[i].appends;
+    }
+  }
+
+  for (size_t i = 0; i < pending_.size(); ++i) {
+    if (pending_[i])
+      merge(i, pending_[i]);
+    pending_[i] = 0;
+  }
+}
@@ -0,0 +1,64 @@
+#ifndef GAME_PHASE_GRAPH_HPP
+#define GAME_PHASE_GRAPH_HPP
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+class JobSystem;
+
+// Level::Step, split into phases. Each phase declares the resources it reads,
+// writes, and appends to. A phase waits for the phases declared before it
+// that conflict with it; the others run in parallel. The result is the same
+// as running the phases in their declared order.
+//
+// Appending doesn't conflict with appending: each phase appends to its own
+// buffer. The buffers are merged, on the calling thread and in declared
+// order, before a phase reading or writing the resource runs, and at the
+// end.
+class PhaseGraph {
+ public:
+  using Resources = uint32_t;
+  using Function = std::function<void(int phase)>;
+  // Merge what |phase| appended to |resources|.
+  using Merge = std::function<void(int phase, Resources resources)>;
+
+  void Clear();
+  // Returns the phase index.
+  int Add(const char* name,
+          Resources reads,
+          Resources writes,
+          Resources appends,
+          Function function);
+  void Build();
+
+  int size() const { return phases_.size(); }
+
+  // Every resource a phase writes or appends to.
+  Resources writes() const;
+
+  // Run every phase. Without a JobSystem, they run in order on the calling
+  // thread.
+  void Run(JobSystem* jobs, const Merge& merge);
+
+ private:
+  struct Phase {
+    const char* name;
+    Resources reads;
+    Resources writes;
+    Resources appends;
+    Function function;
+  };
+  static bool Conflict(const Phase& before, const Phase& after);
+  void MergeBefore(const Phase& phase, const Merge& merge);
+
+  std::vector<Phase> phases_;
+
+  // Phases grouped in waves. A wave only depends on the previous ones.
+  std::vector<std::vector<int>> waves_;
+
+  // What each phase appended and is not merged yet.
+  std::vector<Resources> pending_;
+};
+
+#endif /* GAME_PHASE_GRAPH_HPP */
@@ -1,6 +1,13 @@
 #include "game/Pic.hpp"
 #include <smk/Window.hpp>
 #include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
+
+namespace {
+const SpriteTemplate kPic(img_pic, [](smk::Sprite& sprite) {
+  sprite.SetCenter(0, 8);
+});
+}  // namespace
 
 Pic::Pic(int X,
          int Y,
@@ -15,13 +22,55 @@ Pic::Pic(int X,
   comparateur = Comparateur;
   connexion = Connexion;
   avancement = 0;
-  sprite = smk::Sprite(img_pic);
-  sprite.SetCenter(0, 8);
-  sprite.SetRotation(angle);
+  UpdateGeometry();
 }
 
-void Pic::Draw(smk::Window& window) {
-  sprite.SetPosition(x + avancement * cos(angle * 0.0174532925),
-                     y - avancement * sin(angle * 0.0174532925));
-  window.Draw(sprite);
+bool Pic::Step(int nb_detected) {
+  bool avancer = false;
+  switch (comparateur) {
+    case 0:
+      if (nb_detected < nbRequis)
+        avancer = true;
+      break;
+    case 1:
+      if (nb_detected == nbRequis)
+        avancer = true;
+      break;
+    case 2:
+      if (nb_detected > nbRequis)
+        avancer = true;
+      break;
+  }
+
+  if (avancer) {
+    if (avancement >= 32)
+      return false;
+    avancement += 2;
+  } else {
+    if (avancement <= 0)
+      return false;
+    avancement--;
+  }
+
+  UpdateGeometry();
+  return true;
+}
+
+void Pic::UpdateGeometry() {
+  float rad = float(angle) * 0.0174532925;
+  float p1x = x + (avancement + 32) * cos(rad);
+  float p1y = y - (avancement + 32) * sin(rad);
+  float p2x = x + avancement * cos(rad) + 8 * cos(rad + 1.57079633);
+  float p2y = y - avancement * sin(rad) - 8 * sin(rad + 1.57079633);
+  float p3x = x + avancement * cos(rad) - 8 * cos(rad + 1.57079633);
+  float p3y = y - avancement * sin(rad) + 8 * sin(rad + 1.57079633);
+  l1 = {{p2x, p2y}, {p1x, p1y}};
+  l2 = {{p3x, p3y}, {p1x, p1y}};
+}
+
+void Pic::Draw(DrawList& target) {
+  auto sprite = kPic.At(x + avancement * cos(angle * 0.0174532925),
+                       y - avancement * sin(angle * 0.0174532925));
+  sprite.SetRotation(angle);
+  target.Draw(sprite);
 }
@@ -1,8 +1,9 @@
 #ifndef GAME_PIC_HPP
 #define GAME_PIC_HPP
 
-#include <smk/Sprite.hpp>
 #include <vector>
+#include "game/DrawList.hpp"
+#include "game/Forme.hpp"
 
 namespace smk {
 class Window;
@@ -12,12 +13,14 @@ class Pic {
  public:
   int x, y, angle;
   int avancement;
-  smk::Sprite sprite;
 
   int nbRequis;
   int comparateur;
   std::vector<int> connexion;
 
+  // The two sides of the spike. Updated when it moves.
+  Line l1, l2;
+
   Pic(int X,
       int Y,
       int Angle,
@@ -25,7 +28,14 @@ class Pic {
       int Comparateur,
       std::vector<int> Connexion);
 
-  void Draw(smk::Window& window);
+  // Move toward the position wanted for |nb_detected| connexions detected.
+  // Returns false once the Pic is at rest.
+  bool Step(int nb_detected);
+
+  void Draw(DrawList& target);
+
+ private:
+  void UpdateGeometry();
 };
 
 #endif /* GAME_PIC_HPP */
@@ -1,16 +1,21 @@
 #include "game/Pincette.hpp"
 #include <smk/Window.hpp>
+#include "game/SpriteTemplate.hpp"
+
+namespace {
+const SpriteTemplate kPincette(img_pincette);
+const SpriteTemplate kHero(img_hero_left, [](smk::Sprite& sprite) {
+  sprite.SetScale(0.85, 1);
+});
+}  // namespace
 
 Pincette::Pincette() {
   step_ = 0;
-  pincetteSprite = smk::Sprite(img_pincette);
-  heroSprite = smk::Sprite(img_hero_left);
-  heroSprite.SetScale(0.85, 1);
 }
 
 void Pincette::Step() {
-  pincetteSprite.SetPosition(128, -128);
-  heroSprite.SetPosition(128 + 4, -128 + 304 - 24);
+  pincette_position_ = {128, -128};
+  hero_position_ = {128 + 4, -128 + 304 - 24};
 
   // Bezier interpolation.
   // clang-format off
@@ -27,17 +32,17 @@ void Pincette::Step() {
              2 * t * (1 - t)   * ypos [pos + 1] +
              t * t             * ypos [pos + 2];
 
-  pincetteSprite.Move(dx,dy);
-  heroSprite.Move(dx,dy);
+  pincette_position_ += glm::vec2(dx, dy);
+  hero_position_ += glm::vec2(dx, dy);
 
   // clang-format on
 
   if (step_ > 60 * 3)
-    heroSprite.Move(0, (step_ - 60 * 3) * (step_ - 60 * 3) / 5.0);
+    hero_position_.y += (step_ - 60 * 3) * (step_ - 60 * 3) / 5.0;
   step_++;
 }
 
-void Pincette::Draw(smk::Window& window) {
-  window.Draw(pincetteSprite);
-  window.Draw(heroSprite);
+void Pincette::Draw(DrawList& target) {
+  target.Draw(kPincette.At(pincette_position_.x, pincette_position_.y));
+  target.Draw(kHero.At(hero_position_.x, hero_position_.y));
 }
@@ -1,8 +1,9 @@
 #ifndef GAME_PINCETTE_HPP
 #define GAME_PINCETTE_HPP
 
+#include "game/DrawList.hpp"
 #include "game/Resource.hpp"
-#include <smk/Sprite.hpp>
+#include <glm/glm.hpp>
 
 namespace smk {
 class Window;
@@ -12,12 +13,13 @@ class Pincette {
  public:
   Pincette();
   void Step();
-  void Draw(smk::Window& window);
+  int step() const { return step_; }
+  void Draw(DrawList& target);
 
  private:
   int step_ = 0;
-  smk::Sprite pincetteSprite;
-  smk::Sprite heroSprite;
+  glm::vec2 pincette_position_ = {0.f, 0.f};
+  glm::vec2 hero_position_ = {0.f, 0.f};
 };
 
 #endif /* GAME_PINCETTE_HPP */
@@ -0,0 +1,33 @@
+#ifndef GAME_RANDOM_HPP
+#define GAME_RANDOM_HPP
+
+#include <cstdint>
+#include <random>
+
+// Replace rand(). Every Level owns its own, so that several Levels can be
+// simulated in the same process, on different threads, reproducibly.
+class Random {
+ public:
+  using result_type = std::minstd_rand::result_type;
+
+  explicit Random(result_type seed = 1) : engine_(seed) {}
+
+  // An int in [0, 2^31 - 2]. Use it like rand().
+  int Rand() { return int(engine_()); }
+
+  // UniformRandomBitGenerator, for std::shuffle.
+  result_type operator()() { return engine_(); }
+  static constexpr result_type min() { return std::minstd_rand::min(); }
+  static constexpr result_type max() { return std::minstd_rand::max(); }
+
+  // The next value, without consuming it. It identifies the state.
+  result_type Peek() const {
+    std::minstd_rand copy = engine_;
+    return copy();
+  }
+
+ private:
+  std::minstd_rand engine_;
+};
+
+#endif /* GAME_RANDOM_HPP */
@@ -1,15 +1,16 @@
 #include "game/SaveManager.hpp"
-#include <algorithm>
 #include <fstream>
-#include <iostream>
 #include <sstream>
 
-#ifdef __EMSCRIPTEN__
-#include <emscripten.h>
-#endif
-
 bool intOf(int& t, const std::string& s);
 
+namespace {
+
+// Calls to Sync() closer than this are written once.
+const auto kDebounce = std::chrono::milliseconds(250);
+
+}  // namespace
+
 void SaveManager::Load(std::string savFile) {
   fileName = savFile;
 
@@ -27,17 +28,10 @@ void SaveManager::Load(std::string savFile) {
 }
 
 void SaveManager::Sync() {
-  std::ofstream file(fileName.c_str());
-  if (!file)
-    return;
-
-  for(auto& it : saveList) {
-    file << it.first << std::endl;
-    file << it.second << std::endl;
-  }
-#ifdef __EMSCRIPTEN__
-  EM_ASM(FS.syncfs(false, function(err){console.log(err)});, 0);
-#endif
+  std::string content;
+  for (auto& it : saveList)
+    content += it.first + '\n' + std::to_string(it.second) + '\n';
+  writer_.Write(fileName, std::move(content), kDebounce);
 }
 
 bool intOf(int& t, const std::string& s) {
@@ -3,6 +3,7 @@
 
 #include <map>
 #include <string>
+#include "game/FileWriter.hpp"
 
 struct Save {
   std::string name;
@@ -11,11 +12,18 @@ struct Save {
 
 class SaveManager {
  public:
+  // |writer| writes the file. It must outlive this.
+  explicit SaveManager(FileWriter& writer) : writer_(writer) {}
+
   void Load(std::string savFile);
   //void NewProfile(std::string name);
   //void DeleteProfile(std::string name);
   //void SetLevel(std::string name, int level);
   //int GetLevel(std::string name);
+
+  // Save |saveList|. Never blocks: the file is written by the FileWriter
+  // once the calls stop for a moment, so that a burst of them is written
+  // once.
   void Sync();
   //bool ExistProfile(std::string name);
 
@@ -23,6 +31,7 @@ class SaveManager {
 
  private:
   std::string fileName;
+  FileWriter& writer_;
 };
 
 #endif /* GAME_SAVE_MANAGER_HPP */
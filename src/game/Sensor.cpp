@@ -0,0 +1,58 @@
+#include "game/Sensor.hpp"
+#include <algorithm>
+
+int SensorSystem::Add(Kind kind, int index, const Rectangle& geometry) {
+  kind_.push_back(kind);
+  index_.push_back(index);
+  count_.push_back(0);
+  enabled_.push_back(true);
+  geometry_.push_back(geometry);
+  return kind_.size() - 1;
+}
+
+void SensorSystem::Build() {
+  grid_.Build(geometry_);
+}
+
+void SensorSystem::Update(const Rectangle& geometry,
+                          std::vector<int>& overlaps,
+                          std::vector<SensorEvent>& events) {
+  overlaps_.clear();
+  grid_.Query(geometry, [&](int sensor) {
+    if (enabled_[sensor])
+      overlaps_.push_back(sensor);
+  });
+  std::sort(overlaps_.begin(), overlaps_.end());
+  overlaps_.erase(std::unique(overlaps_.begin(), overlaps_.end()),
+                  overlaps_.end());
+
+  if (overlaps_ == overlaps)
+    return;
+
+  // Both lists are sorted. Walk them together to find the differences.
+  auto previous = overlaps.begin();
+  auto current = overlaps_.begin();
+  while (previous != overlaps.end() || current != overlaps_.end()) {
+    if (current == overlaps_.end() ||
+        (previous != overlaps.end() && *previous < *current)) {
+      count_[*previous]--;
+      events.push_back({SensorEvent::Exit, *previous++});
+    } else if (previous == overlaps.end() || *current < *previous) {
+      count_[*current]++;
+      events.push_back({SensorEvent::Enter, *current++});
+    } else {
+      ++previous;
+      ++current;
+    }
+  }
+  overlaps = overlaps_;
+}
+
+void SensorSystem::Remove(std::vector<int>& overlaps,
+                          std::vector<SensorEvent>& events) {
+  for (int sensor : overlaps) {
+    count_[sensor]--;
+    events.push_back({SensorEvent::Exit, sensor});
+  }
+  overlaps.clear();
+}
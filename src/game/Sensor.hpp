@@ -0,0 +1,69 @@
+#ifndef GAME_SENSOR_HPP
+#define GAME_SENSOR_HPP
+
+#include <vector>
+#include "game/Forme.hpp"
+#include "game/StaticGrid.hpp"
+
+// Trigger volumes of the level: detectors, buttons, teleporters, ... They are
+// registered once after loading. Each body (an Hero) keeps the sorted list of
+// sensors it overlaps, so an update only reports what changed.
+struct SensorEvent {
+  enum Type {
+    Enter,
+    Exit,
+  };
+  Type type;
+  int sensor;
+};
+
+class SensorSystem {
+ public:
+  enum Kind {
+    Accelerator,
+    ArrowLauncherDetector,
+    Button,
+    Detector,
+    Electricity,
+    Finish,
+    Teleporter,
+    TextPopup,
+  };
+
+  // 1. Register the sensors. |index| is the position of the object in its own
+  //    list. Returns the sensor id.
+  int Add(Kind kind, int index, const Rectangle& geometry);
+
+  // 2. Index them.
+  void Build();
+
+  // 3. Move a body to |geometry|. |overlaps| is the list of sensors it was
+  //    overlapping, it is updated. Enter/Exit events are appended to |events|.
+  void Update(const Rectangle& geometry,
+              std::vector<int>& overlaps,
+              std::vector<SensorEvent>& events);
+
+  // The body disappeared. It exits every sensor it was overlapping.
+  void Remove(std::vector<int>& overlaps, std::vector<SensorEvent>& events);
+
+  // Stop reporting the sensor. Bodies inside will exit on their next update.
+  void Disable(int sensor) { enabled_[sensor] = false; }
+
+  Kind kind(int sensor) const { return kind_[sensor]; }
+  int index(int sensor) const { return index_[sensor]; }
+
+  // Number of bodies overlapping the sensor.
+  int count(int sensor) const { return count_[sensor]; }
+
+ private:
+  std::vector<Kind> kind_;
+  std::vector<int> index_;
+  std::vector<int> count_;
+  std::vector<char> enabled_;
+  std::vector<Rectangle> geometry_;
+
+  StaticGrid grid_;
+  std::vector<int> overlaps_;
+};
+
+#endif /* GAME_SENSOR_HPP */
@@ -0,0 +1,108 @@
+#include "game/SoundSource.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace {
+
+// In pixels. Full volume within half a screen of the camera, silent past a
+// screen and a half.
+const float kNear = 320.f;
+const float kFar = 960.f;
+
+// Smaller volume changes aren't sent to the audio thread.
+const float kVolumeStep = 1.f / 64.f;
+
+float Volume(float distance) {
+  return std::clamp((kFar - distance) / (kFar - kNear), 0.f, 1.f);
+}
+
+}  // namespace
+
+SoundSource::SoundSource(const smk::SoundBuffer& buffer, bool loop)
+    : buffer_(&buffer), loop_(loop) {}
+
+SoundSource::~SoundSource() {
+  Release();
+}
+
+SoundSource::SoundSource(const SoundSource& other)
+    : buffer_(other.buffer_), loop_(other.loop_) {}
+
+SoundSource& SoundSource::operator=(const SoundSource& other) {
+  Release();
+  buffer_ = other.buffer_;
+  loop_ = other.loop_;
+  playing_ = false;
+  pending_ = false;
+  return *this;
+}
+
+SoundSource::SoundSource(SoundSource&& other) {
+  *this = std::move(other);
+}
+
+SoundSource& SoundSource::operator=(SoundSource&& other) {
+  if (this == &other)
+    return *this;
+  Release();
+  buffer_ = other.buffer_;
+  loop_ = other.loop_;
+  playing_ = other.playing_;
+  pending_ = other.pending_;
+  queue_ = other.queue_;
+  voice_ = std::exchange(other.voice_, 0);
+  volume_ = other.volume_;
+  return *this;
+}
+
+void SoundSource::Play() {
+  playing_ = loop_;
+  pending_ = true;
+}
+
+void SoundSource::Stop() {
+  playing_ = false;
+  pending_ = false;
+}
+
+void SoundSource::Update(float distance, AudioThread::Queue* queue) {
+  if (!buffer_ || !queue)
+    return;
+  queue_ = queue;
+  float volume = Volume(distance);
+
+  if (pending_) {
+    pending_ = false;
+    Release();
+    if (volume > 0.f)
+      Start(volume);
+    return;
+  }
+
+  if (!voice_) {
+    if (playing_ && volume > 0.f)
+      Start(volume);
+    return;
+  }
+
+  if (volume <= 0.f || (loop_ && !playing_)) {
+    Release();
+    return;
+  }
+  if (std::abs(volume - volume_) >= kVolumeStep) {
+    queue_->SetVolume(voice_, volume);
+    volume_ = volume;
+  }
+}
+
+void SoundSource::Start(float volume) {
+  voice_ = queue_->Play(*buffer_, SoundPriority::Normal, volume, loop_);
+  volume_ = volume;
+}
+
+void SoundSource::Release() {
+  if (voice_)
+    queue_->Stop(voice_);
+  voice_ = 0;
+}
@@ -0,0 +1,47 @@
+#ifndef GAME_SOUND_SOURCE_HPP
+#define GAME_SOUND_SOURCE_HPP
+
+#include <smk/SoundBuffer.hpp>
+#include "game/AudioThread.hpp"
+
+// A sound played by an object of the level. Play and Stop only say what the
+// object wants: the level calls Update once per tick with the distance to the
+// camera, and the sound gets a voice of the audio thread only while it can be
+// heard. Out of range, it is virtual: a loop keeps playing without a voice and
+// is started again once back in range, a one-shot is skipped. Copying the
+// object, or the whole level, copies the buffer but not the playback: the
+// copy is silent until played.
+class SoundSource {
+ public:
+  SoundSource() = default;
+  explicit SoundSource(const smk::SoundBuffer& buffer, bool loop = false);
+  ~SoundSource();
+
+  SoundSource(const SoundSource& other);
+  SoundSource& operator=(const SoundSource& other);
+  SoundSource(SoundSource&& other);
+  SoundSource& operator=(SoundSource&& other);
+
+  void Play();
+  void Stop();
+
+  // Call from the thread stepping the level, after the step. Silent without
+  // |queue|.
+  void Update(float distance, AudioThread::Queue* queue);
+
+ private:
+  void Start(float volume);
+  void Release();
+
+  const smk::SoundBuffer* buffer_ = nullptr;
+  bool loop_ = false;
+  bool playing_ = false;  // For loops. A one-shot ends by itself.
+  bool pending_ = false;  // Played since the last Update.
+
+  // The voice, while in range.
+  AudioThread::Queue* queue_ = nullptr;
+  AudioThread::Voice voice_ = 0;
+  float volume_ = 0.f;
+};
+
+#endif /* GAME_SOUND_SOURCE_HPP */
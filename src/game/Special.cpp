@@ -3,11 +3,23 @@
 #include "game/Lang.hpp"
 #include "game/Level.hpp"
 #include "game/Resource.hpp"
-#include <smk/Input.hpp>
+#include "game/SpriteTemplate.hpp"
 #include <smk/Shape.hpp>
 #include <smk/Sound.hpp>
 #include <smk/Text.hpp>
 
+namespace {
+// clang-format off
+const SpriteTemplate kEndBack(img_arbreDecorsEndBack2);
+const SpriteTemplate kSapin(img_sapin);
+const SpriteTemplate kSapinArm(img_sapin_bras, [](smk::Sprite& s) { s.SetCenter(10, 9); });
+const SpriteTemplate kTree(img_arbre);
+const SpriteTemplate kTreeGlow(img_arbre_white, [](smk::Sprite& s) { s.SetBlendMode(smk::BlendMode::Add); });
+const SpriteTemplate kEndPanel(img_endPanel);
+const SpriteTemplate kCredit(img_credit);
+// clang-format on
+}  // namespace
+
 Special::Special(int M) {
   m = M;
   switch (m) {
@@ -75,6 +87,7 @@ void Special::Step(Level& level) {
           if (time > 60) {
             level.drawn_textpopup_list.push_back(TextPopup(2));
             mode = 1;
+            triggered = true;
             time = 0;
           }
         } else if (time > 0)
@@ -83,7 +96,7 @@ void Special::Step(Level& level) {
         time++;
         if (time > 15) {
           size *= 0.98;
-          level.hero_list[0].sprite.SetScale(size / 100.0);
+          level.hero_list[0].scale = size / 100.0;
           level.hero_list[0].x += (768 - x) *0.01;
           level.hero_list[0].geometry.bottom =
           level.hero_list[0].geometry.top + 24 * (size + 10) / 110.0;
@@ -98,12 +111,12 @@ void Special::Step(Level& level) {
       int& time = var[0];
       int& size = var[1];
       time++;
-      level.hero_list[0].sprite.SetScale(size / 100.0, size / 100.0);
+      level.hero_list[0].scale = size / 100.0;
       size += (95 - size) / 10;
     } break;
 
     case SPECIAL_ARBREBOSS: {
-      static int sequence[4][24] = {
+      static const int sequence[4][24] = {
           {0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11,
            12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23},
           {23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12,
@@ -117,11 +130,8 @@ void Special::Step(Level& level) {
       int& i = var[2];
       int& timeWait = var[3];
 
-      if (timeBeforeSalvo == 30) {
-        auto sound = smk::Sound(SB_boss[SalvoId]);
-        level.sound_list.push_front(std::move(sound));
-        (*(level.sound_list.begin())).Play();
-      }
+      if (timeBeforeSalvo == 30 && level.audio)
+        level.audio->Play(SB_boss[SalvoId], SoundPriority::High);
 
       if (timeBeforeSalvo > 0)
         timeBeforeSalvo--;
@@ -131,10 +141,9 @@ void Special::Step(Level& level) {
           int ii = 0;
           for(auto& arrow_launcher : level.arrowLauncher_list) {
             if (sequence[SalvoId][i] == ii) {
-              level.arrow_list.push_front(
-                  Arrow({arrow_launcher.x + 16, arrow_launcher.y + 16},
-                        {+17 * cos(arrow_launcher.orientation * .0174532925),
-                         -17 * sin(arrow_launcher.orientation * .0174532925)}));
+              level.arrow_pool.Spawn(
+                  {arrow_launcher.x + 16, arrow_launcher.y + 16},
+                  arrow_launcher.ArrowSpeed(level.fixed_point));
               arrow_launcher.sound.Play();
             }
             ii++;
@@ -151,14 +160,14 @@ void Special::Step(Level& level) {
       }
 
       // fire
-      static int posFireX[6] = {556,     556 + 28, 566 + 45,
+      static const int posFireX[6] = {556,     556 + 28, 566 + 45,
                                 566 - 3, 566 + 35, 566 + 23};
-      static int posFireY[6] = {418,      418 + 9,  418 - 9,
+      static const int posFireY[6] = {418,      418 + 9,  418 - 9,
                                 418 - 28, 418 - 44, 418 - 91};
 
       int bougieIndex = 0;
       int nbFire = 0;
-      for (std::list<Button>::iterator itbouton = level.button_list.begin();
+      for (auto itbouton = level.button_list.begin();
            itbouton != level.button_list.end(); ++itbouton) {
         if (itbouton->nb_pressed == itbouton->nb_pressed_required - 1) {
           int xx =
@@ -166,7 +175,8 @@ void Special::Step(Level& level) {
           int yy = posFireY[bougieIndex];
           nbFire++;
           for (int h = 0; h < 4; h++)
-            level.particule_list.push_front(fireParticule(xx, yy));
+            level.particule_list.push_front(
+                fireParticule(xx, yy, level.random_));
         }
         bougieIndex++;
       }
@@ -179,10 +189,11 @@ void Special::Step(Level& level) {
             glm::vec4 c(1.0, 1.0, 1.0, 1.0);  // img_sapinGetPixel(x, y);
             if (c.a > 10) {
               level.particule_list.push_front(
-                  arbreBossParticule(x + 517, y + 300, c));
+                  arbreBossParticule(x + 517, y + 300, c, level.random_));
             }
           }
         erased = true;
+        triggered = true;
       }
 
       // destruct Hero
@@ -191,6 +202,7 @@ void Special::Step(Level& level) {
         Rectangle r(640 - 100, 640, 480, 480 - 100);
         if (IsCollision(itHero->geometry, r)) {
           itHero->life = -1;
+          itHero->cause = DeathCause::Special;
           break;
         }
       }
@@ -198,10 +210,15 @@ void Special::Step(Level& level) {
 
     case SPECIAL_WIND: {
       for (int i = 0; i < 6; i++) {
-        level.particule_list.push_front(
-            particuleWind(112 + rand() % 176, 335 + rand() % 17));
-        level.particule_list.push_front(
-            particuleWind(562 + rand() % 174, 466 + rand() % 14));
+        // One draw per statement: the evaluation order of function arguments
+        // is unspecified.
+        Random& random = level.random_;
+        int x = 112 + random.Rand() % 176;
+        int y = 335 + random.Rand() % 17;
+        level.particule_list.push_front(particuleWind(x, y, random));
+        x = 562 + random.Rand() % 174;
+        y = 466 + random.Rand() % 14;
+        level.particule_list.push_front(particuleWind(x, y, random));
       }
 
     } break;
@@ -230,9 +247,8 @@ void Special::Step(Level& level) {
       }
       if (t > 0) {
         if (t2 <= 0) {
-          auto sound = smk::Sound(SB_start);
-          sound.Play();
-          level.sound_list.push_front(std::move(sound));
+          if (level.audio)
+            level.audio->Play(SB_start, SoundPriority::High);
           t2 = t3;
           t3 = 4 + (t3 - 4) * 0.9;
         } else {
@@ -243,61 +259,54 @@ void Special::Step(Level& level) {
   }
 }
 
-void Special::DrawBackground(smk::Window& window,
+void Special::DrawBackground(DrawList& target,
                              float xcenter,
                              float ycenter) {
   if (erased)
     return;
   if (m == SPECIAL_ARBRE2) {
-    auto sprite = smk::Sprite(img_arbre_texture);
-    // clang-format off
-    for (int x = xcenter - 320 - int(xcenter / 2.67) % 340; x < xcenter + 320; x += 340)
-    for (int y = ycenter - 240 - int(ycenter / 2.67) % 340; y < ycenter + 240; y += 340) {
-      sprite.SetPosition(x, y);
-      window.Draw(sprite);
-    }
-    // clang-format on
+    int x = xcenter - 320 - int(xcenter / 2.67) % 340;
+    int y = ycenter - 240 - int(ycenter / 2.67) % 340;
+    background_.Draw(target, {x, y}, {640 + 340, 480 + 340});
   }
 }
 
-void Special::DrawOverDecoration(smk::Window& window) {
+void Special::DrawOverDecoration(DrawList& target) {
   if (erased)
     return;
   if (m == SPECIAL_END) {
     int t = var[0];
-    auto spr = smk::Sprite(img_arbreDecorsEndBack2);
+    auto spr = kEndBack.At(0, 0);
     spr.SetColor(glm::vec4(1.0, 1.0, 1.0, t / 255.f));
-    window.Draw(spr);
+    target.Draw(spr);
   }
 }
 
-void Special::DrawForeground(smk::Window& window, bool& isWin) {
+void Special::DrawForeground(DrawList& target,
+                             bool space_hold,
+                             bool& isWin) {
   if (erased)
     return;
   switch (m) {
     case SPECIAL_ARBREBOSS: {
       float timesalvo = var[0];
       // Draw the sapin
-      auto spr = smk::Sprite(img_sapin);
-      spr.SetPosition(520, 303);
+      auto spr = kSapin.At(520, 303);
       spr.Move(-3 * sin(timesalvo / 100.0 * 3.14), 0);
-      window.Draw(spr);
+      target.Draw(spr);
 
       float angle1 = 270 - 180 * sin(timesalvo / 100.0 * (3.14));
       float angle2 = angle1 * angle1 / 300;
 
       // Draw the sapin_arm
-      auto sprite_handle = smk::Sprite(img_sapin_bras);
-      sprite_handle.SetCenter(10, 9);
-
-      sprite_handle.SetPosition(520 + 45, 303 + 86);
+      auto sprite_handle = kSapinArm.At(520 + 45, 303 + 86);
       sprite_handle.SetRotation(angle1);
-      window.Draw(sprite_handle);
+      target.Draw(sprite_handle);
 
       sprite_handle.Move(30 * cos(angle1 * 0.0174532925),
                          -30 * sin(angle1 * 0.0174532925));
       sprite_handle.SetRotation(angle2);
-      window.Draw(sprite_handle);
+      target.Draw(sprite_handle);
 
     } break;
     case SPECIAL_END2: {
@@ -313,7 +322,7 @@ void Special::DrawForeground(smk::Window& window, bool& isWin) {
           case 0:
             pos += (400.0 - pos) / 30.0;
             if ((400 - pos) < 30) {
-              if (window.input().IsKeyHold(GLFW_KEY_SPACE)) {
+              if (space_hold) {
                 mode = 1;
               }
             }
@@ -336,7 +345,7 @@ void Special::DrawForeground(smk::Window& window, bool& isWin) {
             if (color < 255) {
               color += 2;
             } else {
-              if (window.input().IsKeyHold(GLFW_KEY_SPACE))
+              if (space_hold)
                 isWin = true;
               color = 255;
             }
@@ -349,32 +358,26 @@ void Special::DrawForeground(smk::Window& window, bool& isWin) {
       auto rect = smk::Shape::Square();
       rect.SetScale(6400, 4800);
       rect.SetColor({0, 0, 0, t / 2 / 255});
-      window.Draw(rect);
+      target.Draw(rect);
 
       // tree
-      auto tree = smk::Sprite(img_arbre);
-      tree.SetPosition(700, 348);
-      window.Draw(tree);
+      target.Draw(kTree.At(700, 348));
 
-      auto tree_glow = smk::Sprite(img_arbre_white);
-      tree_glow.SetPosition(700, 348);
-      tree_glow.SetBlendMode(smk::BlendMode::Add);
+      auto tree_glow = kTreeGlow.At(700, 348);
       tree_glow.SetColor(glm::vec4(1.0, 1.0, 1.0, t / 255.f));
-      window.Draw(tree_glow);
+      target.Draw(tree_glow);
 
       if (pos > 0) {
-        auto sprite = smk::Sprite(img_endPanel);
-        sprite.SetPosition(960 - 640 - 360 + pos, 0 + pos2);
-        window.Draw(sprite);
+        target.Draw(kEndPanel.At(960 - 640 - 360 + pos, 0 + pos2));
 
         smk::Text str[7];
-        str[0].SetString(tr(L"end1"));
-        str[1].SetString(tr(L"end2"));
-        str[2].SetString(tr(L"end3"));
-        str[3].SetString(tr(L"end4"));
-        str[4].SetString(tr(L"end5"));
-        str[5].SetString(tr(L"end6"));
-        str[6].SetString(tr(L"end7"));
+        str[0].SetString(std::wstring(tr(TextId::end1)));
+        str[1].SetString(std::wstring(tr(TextId::end2)));
+        str[2].SetString(std::wstring(tr(TextId::end3)));
+        str[3].SetString(std::wstring(tr(TextId::end4)));
+        str[4].SetString(std::wstring(tr(TextId::end5)));
+        str[5].SetString(std::wstring(tr(TextId::end6)));
+        str[6].SetString(std::wstring(tr(TextId::end7)));
 
         str[0].SetPosition(-15 + pos, 30 + pos2);
         str[1].SetPosition(-15 + pos, 60 + pos2);
@@ -387,16 +390,15 @@ void Special::DrawForeground(smk::Window& window, bool& isWin) {
         for (int i = 0; i < 7; i++) {
           str[i].SetFont(font_arial);
           str[i].SetColor(glm::vec4(0.0, 0.0, 0.0, 0.0));
-          window.Draw(str[i]);
+          target.Draw(str[i]);
           str[i].Move(0, 1);
           str[i].SetColor(glm::vec4(60, 60, 60, 255) / 255.f);
-          window.Draw(str[i]);
+          target.Draw(str[i]);
         }
 
-        auto sprCredit = smk::Sprite(img_credit);
-        sprCredit.SetPosition(960 - 640, 0);
+        auto sprCredit = kCredit.At(960 - 640, 0);
         sprCredit.SetColor(glm::vec4(color, color, color, alpha) / 255.f);
-        window.Draw(sprCredit);
+        target.Draw(sprCredit);
       }
 
     } break;
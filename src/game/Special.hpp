@@ -2,13 +2,14 @@
 #define GAME_SPECIAL_HPP
 
 #include <list>
-#include <smk/Window.hpp>
+#include "game/DrawList.hpp"
 #include <smk/Sound.hpp>
 #include <smk/Sprite.hpp>
 #include <vector>
-#include "game/Arrow.hpp"
 #include "game/ArrowLauncher.hpp"
 #include "game/Particule.hpp"
+#include "game/Resource.hpp"
+#include "game/TiledBackground.hpp"
 
 enum {
   SPECIAL_ARBRE = 0,
@@ -27,14 +28,19 @@ class Special {
   int m;
   Special(int M);
   std::vector<int> var;
-  std::vector<smk::Sprite> sprite;
 
   void Step(Level& level);
-  void DrawBackground(smk::Window& window, float xcenter, float ycenter);
-  void DrawOverDecoration(smk::Window& window);
-  void DrawForeground(smk::Window& window, bool& isWin);
+  void DrawBackground(DrawList& target, float xcenter, float ycenter);
+  void DrawOverDecoration(DrawList& target);
+  void DrawForeground(DrawList& target, bool space_hold, bool& isWin);
 
   bool erased = false;
+  // Set by Step when it reaches its goal. For the telemetry.
+  bool triggered = false;
+
+ private:
+  // The tree texture behind SPECIAL_ARBRE2.
+  TiledBackground background_{img_arbre_texture};
 };
 
 #endif /* GAME_SPECIAL_HPP */
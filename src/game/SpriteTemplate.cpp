@@ -0,0 +1,15 @@
+#include "game/SpriteTemplate.hpp"
+
+SpriteTemplate::SpriteTemplate(const smk::Texture& texture, Setup setup)
+    : texture_(&texture), setup_(setup) {}
+
+smk::Sprite SpriteTemplate::At(float x, float y) const {
+  if (!sprite_) {
+    sprite_ = smk::Sprite(*texture_);
+    if (setup_)
+      setup_(*sprite_);
+  }
+  smk::Sprite sprite = *sprite_;
+  sprite.SetPosition(x, y);
+  return sprite;
+}
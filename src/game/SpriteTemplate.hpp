@@ -0,0 +1,27 @@
+#ifndef GAME_SPRITE_TEMPLATE_HPP
+#define GAME_SPRITE_TEMPLATE_HPP
+
+#include <optional>
+#include <smk/Sprite.hpp>
+#include <smk/Texture.hpp>
+
+// What every object of a kind draws alike: the texture, and the center,
+// scale, rotation or blend mode applied by |setup|. Objects keep only their
+// own position and color, and draw a copy placed by At().
+//
+// The sprite is built on the first draw, once the textures are loaded. Its
+// copies share the texture and the quad.
+class SpriteTemplate {
+ public:
+  using Setup = void (*)(smk::Sprite&);
+  explicit SpriteTemplate(const smk::Texture& texture, Setup setup = nullptr);
+
+  smk::Sprite At(float x, float y) const;
+
+ private:
+  const smk::Texture* texture_;
+  Setup setup_;
+  mutable std::optional<smk::Sprite> sprite_;
+};
+
+#endif /* GAME_SPRITE_TEMPLATE_HPP */
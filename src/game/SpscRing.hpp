@@ -0,0 +1,68 @@
+#ifndef GAME_SPSC_RING_HPP
+#define GAME_SPSC_RING_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// A queue of at most |N| values, from one producer thread to one consumer
+// thread. Never blocks nor locks: Push fails while the queue is full.
+template <typename T, size_t N>
+class SpscRing {
+  static_assert(N && !(N & (N - 1)), "N must be a power of two");
+
+ public:
+  // From the producer.
+  bool Push(const T& value) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    if (head - tail_.load(std::memory_order_acquire) == N)
+      return false;
+    ring_[head % N] = value;
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // From the consumer.
+  bool Pop(T& value) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire))
+      return false;
+    value = ring_[tail % N];
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // From the consumer: pop every value at once. They are passed to
+  // |consume(const T* values, size_t size)| as one or two contiguous runs,
+  // two when they wrap around the end of the ring. Returns their count.
+  template <typename Consume>
+  size_t PopAll(Consume consume) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    size_t head = head_.load(std::memory_order_acquire);
+    size_t size = head - tail;
+    if (!size)
+      return 0;
+    size_t begin = tail % N;
+    size_t first = std::min(size, N - begin);
+    consume(&ring_[begin], first);
+    if (first < size)
+      consume(&ring_[0], size - first);
+    tail_.store(head, std::memory_order_release);
+    return size;
+  }
+
+  // From the producer, which may only see it too large.
+  size_t size() const {
+    return head_.load(std::memory_order_relaxed) -
+           tail_.load(std::memory_order_acquire);
+  }
+
+ private:
+  std::array<T, N> ring_;
+  // Only increase. The slot of an index is index % N.
+  std::atomic<size_t> head_{0};  // Written by Push.
+  std::atomic<size_t> tail_{0};  // Written by Pop and PopAll.
+};
+
+#endif /* GAME_SPSC_RING_HPP */
@@ -0,0 +1,53 @@
+#ifndef GAME_STATE_HASH_HPP
+#define GAME_STATE_HASH_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// 64 bits hash of the simulation state, fed field by field. Floats are hashed
+// by their bits: two runs agree only if they computed exactly the same
+// values.
+class StateHash {
+ public:
+  void Add(uint64_t value) {
+    hash_ = (hash_ ^ value) * 0x100000001B3ull;
+    hash_ ^= hash_ >> 32;
+  }
+  void Add(int value) { Add(uint64_t(int64_t(value))); }
+  void Add(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    Add(uint64_t(bits));
+  }
+
+  uint64_t value() const { return hash_; }
+
+ private:
+  uint64_t hash_ = 0xCBF29CE484222325ull;
+};
+
+// Two runs recorded the hash of the state at the same ticks. Once the states
+// differ, they are not expected to become equal again, so the first
+// different hash is found by bisection. Returns -1 when they agree.
+inline int FirstDivergence(const std::vector<uint64_t>& a,
+                           const std::vector<uint64_t>& b) {
+  int size = std::min(a.size(), b.size());
+  if (size == 0 || a[size - 1] == b[size - 1])
+    return a.size() == b.size() ? -1 : size;
+
+  // a[left - 1] == b[left - 1] and a[right] != b[right].
+  int left = 0;
+  int right = size - 1;
+  while (left < right) {
+    int middle = (left + right) / 2;
+    if (a[middle] == b[middle])
+      left = middle + 1;
+    else
+      right = middle;
+  }
+  return right;
+}
+
+#endif /* GAME_STATE_HASH_HPP */
@@ -0,0 +1,81 @@
+#include "game/StaticGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+void StaticGrid::Build(const std::vector<Rectangle>& rectangles,
+                       float cell_size) {
+  cell_size_ = cell_size;
+  rectangles_.clear();
+  cell_start_.clear();
+  cell_items_.clear();
+  width_ = 0;
+  height_ = 0;
+
+  // Store every rectangle with left <= right and top <= bottom, so that the
+  // queries do not have to care about the orientation.
+  for (const Rectangle& r : rectangles) {
+    rectangles_.push_back(Rectangle(std::min(r.left, r.right),   //
+                                    std::max(r.left, r.right),   //
+                                    std::max(r.top, r.bottom),   //
+                                    std::min(r.top, r.bottom))); //
+  }
+
+  if (rectangles_.empty())
+    return;
+
+  bounds_ = rectangles_.front();
+  for (const Rectangle& r : rectangles_) {
+    bounds_.left = std::min(bounds_.left, r.left);
+    bounds_.top = std::min(bounds_.top, r.top);
+    bounds_.right = std::max(bounds_.right, r.right);
+    bounds_.bottom = std::max(bounds_.bottom, r.bottom);
+  }
+
+  width_ = CellX(bounds_.right) + 1;
+  height_ = CellY(bounds_.bottom) + 1;
+
+  // Counting sort of the rectangles into their cells.
+  cell_start_.assign(width_ * height_ + 1, 0);
+  auto for_each_cell = [&](const Rectangle& r, auto f) {
+    for (int y = CellY(r.top); y <= CellY(r.bottom); ++y)
+      for (int x = CellX(r.left); x <= CellX(r.right); ++x)
+        f(x + y * width_);
+  };
+
+  for (const Rectangle& r : rectangles_)
+    for_each_cell(r, [&](int cell) { cell_start_[cell + 1]++; });
+
+  for (size_t i = 1; i < cell_start_.size(); ++i)
+    cell_start_[i] += cell_start_[i - 1];
+
+  cell_items_.resize(cell_start_.back());
+  std::vector<int> fill(cell_start_.begin(), cell_start_.end() - 1);
+  for (int i = 0; i < (int)rectangles_.size(); ++i)
+    for_each_cell(rectangles_[i], [&](int cell) { cell_items_[fill[cell]++] = i; });
+}
+
+int StaticGrid::CellX(float x) const {
+  return int(std::floor((x - bounds_.left) / cell_size_));
+}
+
+int StaticGrid::CellY(float y) const {
+  return int(std::floor((y - bounds_.top) / cell_size_));
+}
+
+bool StaticGrid::Contains(Point p) const {
+  if (rectangles_.empty())
+    return false;
+
+  int x = CellX(p.x);
+  int y = CellY(p.y);
+  if (x < 0 || y < 0 || x >= width_ || y >= height_)
+    return false;
+
+  int cell = x + y * width_;
+  for (int i = cell_start_[cell]; i < cell_start_[cell + 1]; ++i) {
+    const Rectangle& r = rectangles_[cell_items_[i]];
+    if (r.left <= p.x && p.x <= r.right && r.top <= p.y && p.y <= r.bottom)
+      return true;
+  }
+  return false;
+}
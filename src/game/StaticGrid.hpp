@@ -0,0 +1,74 @@
+#ifndef GAME_STATIC_GRID_HPP
+#define GAME_STATIC_GRID_HPP
+
+#include <algorithm>
+#include <vector>
+#include "game/Forme.hpp"
+
+// Uniform grid over rectangles that never move once the level is loaded (the
+// blocks, the invisible blocks, the sensors). Answers "what is under this
+// point/rectangle" by looking at a few cells instead of walking every
+// rectangle of the level.
+class StaticGrid {
+ public:
+  void Build(const std::vector<Rectangle>& rectangles, float cell_size = 64.f);
+
+  // Same result as testing IsCollision(p, r) against every rectangle.
+  bool Contains(Point p) const;
+
+  // Call |f(index)| for every rectangle colliding with |r|, in the sense of
+  // IsCollision(r, rectangle). A rectangle spanning several cells can be
+  // reported more than once.
+  template <typename F>
+  void Query(const Rectangle& r, F f) const;
+
+  // Bounding box of every rectangle. Only meaningful when !empty().
+  const Rectangle& bounds() const { return bounds_; }
+  bool empty() const { return rectangles_.empty(); }
+
+ private:
+  int CellX(float x) const;
+  int CellY(float y) const;
+
+  float cell_size_ = 64.f;
+  int width_ = 0;
+  int height_ = 0;
+  Rectangle bounds_;
+
+  // Rectangles of cell (x,y) are:
+  // cell_items_[cell_start_[x + y * width_] ... cell_start_[x + y * width_ + 1]]
+  std::vector<int> cell_start_;
+  std::vector<int> cell_items_;
+  std::vector<Rectangle> rectangles_;
+};
+
+template <typename F>
+void StaticGrid::Query(const Rectangle& r, F f) const {
+  if (rectangles_.empty())
+    return;
+
+  float left = std::min(r.left, r.right);
+  float right = std::max(r.left, r.right);
+  float top = std::min(r.top, r.bottom);
+  float bottom = std::max(r.top, r.bottom);
+
+  int x_min = std::max(0, CellX(left));
+  int x_max = std::min(width_ - 1, CellX(right));
+  int y_min = std::max(0, CellY(top));
+  int y_max = std::min(height_ - 1, CellY(bottom));
+
+  for (int y = y_min; y <= y_max; ++y) {
+    for (int x = x_min; x <= x_max; ++x) {
+      int cell = x + y * width_;
+      for (int i = cell_start_[cell]; i < cell_start_[cell + 1]; ++i) {
+        const Rectangle& item = rectangles_[cell_items_[i]];
+        if (left <= item.right && item.left <= right &&  //
+            top <= item.bottom && item.top <= bottom) {
+          f(cell_items_[i]);
+        }
+      }
+    }
+  }
+}
+
+#endif /* GAME_STATIC_GRID_HPP */
@@ -1,9 +1,16 @@
 #include "game/StaticMirror.hpp"
 #include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
 #include <smk/Window.hpp>
 #include <smk/Shape.hpp>
 #include <smk/Color.hpp>
 
+namespace {
+const SpriteTemplate kMirror(img_miroir, [](smk::Sprite& sprite) {
+  sprite.SetCenter(0, 4);
+});
+}  // namespace
+
 StaticMirror::StaticMirror(int x1,
                            int y1,
                            int x2,
@@ -20,17 +27,16 @@ StaticMirror::StaticMirror(int x1,
 
   xcenter = (x1 + x2) / 2;
   ycenter = (y1 + y2) / 2;
-
-  sprite = smk::Sprite(img_miroir);
-  sprite.SetPosition(x1, y1);
-  sprite.SetCenter(0, 4);
-  sprite.SetRotation(angle);
-  sprite.SetScaleX(sqrt((x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1)) / 32.0);
 }
 
-void StaticMirror::Draw(smk::Window& window) {
+void StaticMirror::Draw(DrawList& target) {
   auto line = smk::Shape::Line({xcenter, ycenter}, {xattach, yattach}, 2);
   line.SetColor(smk::Color::Black);
-  window.Draw(line);
-  window.Draw(sprite);
+  target.Draw(line);
+
+  glm::vec2 direction = geometry.b - geometry.a;
+  auto sprite = kMirror.At(geometry.a.x, geometry.a.y);
+  sprite.SetRotation(angle);
+  sprite.SetScaleX(glm::length(direction) / 32.f);
+  target.Draw(sprite);
 }
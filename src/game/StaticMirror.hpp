@@ -2,8 +2,8 @@
 #define GAME_STATIC_MIRROR_HPP
 
 #include <cmath>
+#include "game/DrawList.hpp"
 #include "game/Forme.hpp"
-#include <smk/Sprite.hpp>
 
 namespace smk {
 class Window;
@@ -14,12 +14,11 @@ class Window;
 class StaticMirror {
  public:
   Line geometry;
-  smk::Sprite sprite;
   int xattach, yattach;
   int xcenter, ycenter;
   int angle;
   StaticMirror(int x1, int y1, int x2, int y2, int Xattach, int Yattach);
-  void Draw(smk::Window& window);
+  void Draw(DrawList& target);
 };
 
 #endif /* GAME_STATIC_MIRROR_HPP */
@@ -0,0 +1,62 @@
+#include "game/Telemetry.hpp"
+#include <chrono>
+
+namespace {
+
+// How often the background thread writes the buffer.
+const auto kFlushPeriod = std::chrono::seconds(2);
+
+}  // namespace
+
+Telemetry::Telemetry(const std::string& path) {
+  file_ = std::fopen(path.c_str(), "ab");
+  if (!file_)
+    return;
+  std::fseek(file_, 0, SEEK_END);
+  if (std::ftell(file_) == 0)
+    std::fwrite(kTelemetryMagic, sizeof(kTelemetryMagic), 1, file_);
+#ifndef __EMSCRIPTEN__
+  thread_ = std::thread(&Telemetry::Work, this);
+#endif
+}
+
+Telemetry::~Telemetry() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    quit_ = true;
+  }
+  wake_.notify_one();
+  if (thread_.joinable())
+    thread_.join();
+  if (file_) {
+    Drain();
+    std::fclose(file_);
+  }
+}
+
+void Telemetry::Record(const TelemetryEvent& event) {
+  if (!ring_.Push(event)) {
+    dropped_++;
+    return;
+  }
+
+#ifdef __EMSCRIPTEN__
+  // No threads. The file system is in memory, writing is cheap.
+  if (file_ && ring_.size() >= kCapacity / 2)
+    Drain();
+#endif
+}
+
+void Telemetry::Work() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!wake_.wait_for(lock, kFlushPeriod, [&] { return quit_; }))
+    Drain();
+}
+
+void Telemetry::Drain() {
+  auto write = [&](const TelemetryEvent* events, size_t size) {
+    std::fwrite(events, sizeof(TelemetryEvent), size, file_);
+  };
+  if (ring_.PopAll(write))
+    std::fflush(file_);
+}
@@ -0,0 +1,46 @@
+#ifndef GAME_TELEMETRY_HPP
+#define GAME_TELEMETRY_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "game/SpscRing.hpp"
+#include "game/TelemetryEvent.hpp"
+
+// Gameplay events, appended to a log file. Record() never blocks nor locks:
+// the events go to a ring buffer, written to the file in batches by a
+// background thread. Events recorded while the buffer is full are dropped.
+class Telemetry {
+ public:
+  explicit Telemetry(const std::string& path);
+  // Write what is still in the buffer.
+  ~Telemetry();
+  Telemetry(const Telemetry&) = delete;
+  Telemetry& operator=(const Telemetry&) = delete;
+
+  // From a single thread at a time.
+  void Record(const TelemetryEvent& event);
+
+  int dropped() const { return dropped_; }
+
+ private:
+  void Work();
+  // Append the events recorded so far. Only from one thread.
+  void Drain();
+
+  static constexpr size_t kCapacity = 4096;
+  SpscRing<TelemetryEvent, kCapacity> ring_;
+  std::atomic<int> dropped_{0};
+
+  std::FILE* file_ = nullptr;
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool quit_ = false;
+  std::thread thread_;
+};
+
+#endif /* GAME_TELEMETRY_HPP */
@@ -0,0 +1,50 @@
+#ifndef GAME_TELEMETRY_EVENT_HPP
+#define GAME_TELEMETRY_EVENT_HPP
+
+#include <cstdint>
+#include <string>
+
+// A record of the telemetry log. The file is "ICT1" followed by the records,
+// in the byte order of the machine writing them.
+enum class TelemetryType : uint8_t {
+  Start,    // The level is shown to the player.
+  Death,    // A hero died, at (x, y).
+  Restart,  // The player asked to restart.
+  Win,      // |tick| is the time to complete the level.
+  Special,  // A special reached its goal.
+};
+
+// What took the last life point of a hero.
+enum class DeathCause : uint8_t {
+  Unknown,
+  Laser,
+  Spike,
+  Creeper,
+  Electricity,
+  Arrow,
+  Special,
+};
+
+struct TelemetryEvent {
+  uint32_t level = 0;  // TelemetryLevelId() of the level file.
+  int32_t tick = 0;
+  float x = 0.f;
+  float y = 0.f;
+  TelemetryType type = TelemetryType::Start;
+  DeathCause cause = DeathCause::Unknown;
+  uint16_t special = 0;  // Special::m, for Special.
+};
+static_assert(sizeof(TelemetryEvent) == 20, "The log format changed");
+
+constexpr char kTelemetryMagic[4] = {'I', 'C', 'T', '1'};
+
+// FNV-1a of the file name, without its directory. The same level has the same
+// id wherever the game is installed.
+inline uint32_t TelemetryLevelId(const std::string& fileName) {
+  uint32_t hash = 0x811C9DC5u;
+  for (size_t i = fileName.find_last_of("/\\") + 1; i < fileName.size(); ++i)
+    hash = (hash ^ uint8_t(fileName[i])) * 0x01000193u;
+  return hash;
+}
+
+#endif /* GAME_TELEMETRY_EVENT_HPP */
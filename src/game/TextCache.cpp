@@ -0,0 +1,89 @@
+#include "game/TextCache.hpp"
+#include <algorithm>
+#include <cmath>
+#include <smk/Color.hpp>
+#include <smk/Text.hpp>
+#include <smk/View.hpp>
+
+TextCache text_cache;
+
+namespace {
+// Glyphs can be drawn slightly outside of the computed dimensions.
+const int padding = 4;
+
+// Texts drawn recently enough are kept.
+const size_t capacity = 128;
+}  // namespace
+
+TextCache::Label& TextCache::Get(const smk::Font& font,
+                                 std::wstring_view string) {
+  auto& labels = labels_[&font];
+  auto it = labels.find(string);
+  if (it != labels.end()) {
+    it->second.last_use = ++use_;
+    return it->second;
+  }
+
+  // Forget the least recently used label.
+  if (size_ >= capacity) {
+    Labels* oldest_labels = nullptr;
+    Labels::iterator oldest;
+    for (auto& font_labels : labels_) {
+      Labels& labels = font_labels.second;
+      for (auto label = labels.begin(); label != labels.end(); ++label) {
+        if (!oldest_labels ||
+            label->second.last_use < oldest->second.last_use) {
+          oldest_labels = &labels;
+          oldest = label;
+        }
+      }
+    }
+    oldest_labels->erase(oldest);
+    size_--;
+  }
+
+  Label& label = labels.emplace(std::wstring(string), Label()).first->second;
+  label.last_use = ++use_;
+  size_++;
+
+  smk::Text text(font, std::wstring(string));
+  label.dimensions = text.ComputeDimensions();
+  int width = std::ceil(label.dimensions.x) + 2 * padding;
+  int height = std::ceil(label.dimensions.y) + 2 * padding;
+
+  // The glyphs are drawn in white, the sprite color gives the final color.
+  // The transparent background is white too, so that the antialiased edges
+  // don't turn dark.
+  label.framebuffer = std::make_unique<smk::Framebuffer>(width, height);
+  smk::View view;
+  view.SetCenter(width / 2.f, height / 2.f);
+  view.SetSize(width, height);
+  label.framebuffer->SetView(view);
+  label.framebuffer->Clear({1.f, 1.f, 1.f, 0.f});
+  text.SetPosition(padding, padding);
+  text.SetColor(smk::Color::White);
+  label.framebuffer->Draw(text);
+
+  label.sprite = smk::Sprite(*label.framebuffer);
+  return label;
+}
+
+void TextCache::Draw(smk::RenderTarget& target,
+                     const smk::Font& font,
+                     std::wstring_view string,
+                     glm::vec2 position,
+                     glm::vec4 color) {
+  if (string.empty())
+    return;
+  Label& label = Get(font, string);
+  label.sprite.SetPosition(position - glm::vec2(padding, padding));
+  label.sprite.SetColor(color);
+  target.Draw(label.sprite);
+}
+
+glm::vec2 TextCache::Dimensions(const smk::Font& font,
+                                std::wstring_view string) {
+  if (string.empty())
+    return {0.f, 0.f};
+  return Get(font, string).dimensions;
+}
@@ -0,0 +1,47 @@
+#ifndef GAME_TEXT_CACHE_HPP
+#define GAME_TEXT_CACHE_HPP
+
+#include <map>
+#include <memory>
+#include <smk/Font.hpp>
+#include <smk/Framebuffer.hpp>
+#include <smk/RenderTarget.hpp>
+#include <smk/Sprite.hpp>
+#include <string>
+#include <string_view>
+
+// smk::Text lays out and draws every glyph, every frame. Labels drawn through
+// the TextCache are rendered once into a texture, then drawn as a single
+// sprite. A label is rebuilt only when its font or its string changes.
+// Position and color are free to change every frame.
+class TextCache {
+ public:
+  // Draw |string| with its top-left corner at |position|.
+  void Draw(smk::RenderTarget& target,
+            const smk::Font& font,
+            std::wstring_view string,
+            glm::vec2 position,
+            glm::vec4 color);
+
+  // Same as smk::Text::ComputeDimensions().
+  glm::vec2 Dimensions(const smk::Font& font, std::wstring_view string);
+
+ private:
+  struct Label {
+    std::unique_ptr<smk::Framebuffer> framebuffer;
+    smk::Sprite sprite;
+    glm::vec2 dimensions;
+    int last_use = 0;
+  };
+  Label& Get(const smk::Font& font, std::wstring_view string);
+
+  // Looked up without copying the string.
+  using Labels = std::map<std::wstring, Label, std::less<>>;
+  std::map<const smk::Font*, Labels> labels_;
+  size_t size_ = 0;
+  int use_ = 0;
+};
+
+extern TextCache text_cache;
+
+#endif /* GAME_TEXT_CACHE_HPP */
@@ -5,6 +5,12 @@
 #include <smk/Window.hpp>
 #include "game/Lang.hpp"
 #include "game/Resource.hpp"
+#include "game/SpriteTemplate.hpp"
+#include "game/TextCache.hpp"
+
+namespace {
+const SpriteTemplate kSpace(img_decorSpace);
+}  // namespace
 
 TextPopup::TextPopup(int t) {
   switch (t) {
@@ -14,10 +20,10 @@ TextPopup::TextPopup(int t) {
       geometry.top = 160;
       geometry.bottom = 160 + 96;
       text.push_back({
-          tr(L"arbret11"),
-          tr(L"arbret12"),
-          tr(L"arbret13"),
-          tr(L"arbret14"),
+          TextId::arbret11,
+          TextId::arbret12,
+          TextId::arbret13,
+          TextId::arbret14,
       });
       break;
     case 1:
@@ -26,61 +32,61 @@ TextPopup::TextPopup(int t) {
       geometry.top = 160;
       geometry.bottom = 448;
       text.push_back({
-          tr(L"arbret21"),
+          TextId::arbret21,
       });
       text.push_back({
-          tr(L"arbret22"),
+          TextId::arbret22,
       });
       break;
     case 2:
       text.push_back({
-          tr(L"arbret31"),
-          tr(L"arbret32"),
+          TextId::arbret31,
+          TextId::arbret32,
       });
       text.push_back({
-          tr(L"arbret41"),
-          tr(L"arbret42"),
+          TextId::arbret41,
+          TextId::arbret42,
       });
       text.push_back({
-          tr(L"arbret51"),
-          tr(L"arbret52"),
-          tr(L"arbret53"),
-          tr(L"arbret54"),
+          TextId::arbret51,
+          TextId::arbret52,
+          TextId::arbret53,
+          TextId::arbret54,
       });
       text.push_back({
-          tr(L"arbret61"),
-          tr(L"arbret62"),
-          tr(L"arbret63"),
-          tr(L"arbret64"),
-          tr(L"arbret65"),
+          TextId::arbret61,
+          TextId::arbret62,
+          TextId::arbret63,
+          TextId::arbret64,
+          TextId::arbret65,
       });
       text.push_back({
-          tr(L"arbret71"),
-          tr(L"arbret72"),
-          tr(L"arbret73"),
-          tr(L"arbret74"),
-          tr(L"arbret75"),
+          TextId::arbret71,
+          TextId::arbret72,
+          TextId::arbret73,
+          TextId::arbret74,
+          TextId::arbret75,
       });
       text.push_back({
-          tr(L"arbret81"),
-          tr(L"arbret82"),
-          tr(L"arbret83"),
+          TextId::arbret81,
+          TextId::arbret82,
+          TextId::arbret83,
       });
       text.push_back({
-          tr(L"arbret91"),
-          tr(L"arbret92"),
-          tr(L"arbret93"),
+          TextId::arbret91,
+          TextId::arbret92,
+          TextId::arbret93,
       });
       text.push_back({
-          tr(L"arbret101"),
-          tr(L"arbret102"),
-          tr(L"arbret103"),
-          tr(L"arbret104"),
-          tr(L"arbret105"),
+          TextId::arbret101,
+          TextId::arbret102,
+          TextId::arbret103,
+          TextId::arbret104,
+          TextId::arbret105,
       });
       text.push_back({
-          tr(L"arbret111"),
-          tr(L"arbret112"),
+          TextId::arbret111,
+          TextId::arbret112,
       });
       break;
     case 3: {
@@ -89,31 +95,27 @@ TextPopup::TextPopup(int t) {
       geometry.top = 32;
       geometry.bottom = 480;
       text.push_back({
-          tr(L"instruction1"),
-          tr(L"instruction2"),
-          tr(L"instruction3"),
-          tr(L"instruction4"),
-          tr(L"instruction5"),
+          TextId::instruction1,
+          TextId::instruction2,
+          TextId::instruction3,
+          TextId::instruction4,
+          TextId::instruction5,
       });
       text.push_back({
-          tr(L"instruction6"),
-          tr(L"instruction7"),
-          tr(L"instruction8"),
+          TextId::instruction6,
+          TextId::instruction7,
+          TextId::instruction8,
       });
     } break;
   }
-  spaceSprite = smk::Sprite(img_decorSpace);
 }
 
-bool TextPopup::Step(smk::Window& window) {
+bool TextPopup::Step(bool next) {
   time++;
   horizontal_shift += (100 - horizontal_shift) / 10.0;
 
   if (time > 10) {
-    if (window.input().IsMousePressed(GLFW_MOUSE_BUTTON_1) ||
-        window.input().IsKeyPressed(GLFW_KEY_SPACE) ||
-        window.input().IsKeyPressed(GLFW_KEY_ENTER) ||
-        window.input().IsCursorReleased()) {
+    if (next) {
       p++;
       horizontal_shift = 640;
       time = 0;
@@ -124,13 +126,13 @@ bool TextPopup::Step(smk::Window& window) {
   return false;
 }
 
-void TextPopup::Draw(smk::Window& window) {
+void TextPopup::Draw(DrawList& target) {
   if (p >= (int)text.size())
     return;
   // FloatRect rect = window.GetView().GetRect();
   // drawing cadre
-  float left = window.GetView().Left();
-  float top = window.GetView().Top();
+  float left = target.GetView().Left();
+  float top = target.GetView().Top();
   int x1 = left + 640 / 5;
   int y1 = top + 480 / 5 + horizontal_shift;
 
@@ -150,42 +152,39 @@ void TextPopup::Draw(smk::Window& window) {
   for (glm::vec2 position : {glm::vec2(x1, y1), glm::vec2(x2, y1)}) {
     circle_1.SetPosition(position);
     circle_2.SetPosition(position);
-    window.Draw(circle_1);
-    window.Draw(circle_2);
+    target.Draw(circle_1);
+    target.Draw(circle_2);
   }
 
   auto rect = smk::Shape::Square();
   rect.SetPosition(x1, y1 - r);
   rect.SetScale(x2 - x1, y2 - y1 + 2 * r);
   rect.SetColor(c0);
-  window.Draw(rect);
+  target.Draw(rect);
 
   rect.SetPosition(x1 - r, y1);
   rect.SetScale(x2 - x1 + 2 * r, y2 - y1);
-  window.Draw(rect);
+  target.Draw(rect);
 
   rect.SetColor(c1);
 
   rect.SetPosition(x1, y1 - r + e);
   rect.SetScale(x2 - x1, y2 - y1 + 2 * r - 2 * e);
   rect.SetColor(c1);
-  window.Draw(rect);
+  target.Draw(rect);
 
   rect.SetPosition(x1 - r + e, y1);
   rect.SetScale(x2 - x1 + 2 * r - 2 * e, y2 - y1);
-  window.Draw(rect);
+  target.Draw(rect);
 
   // drawing texte
   int x = x1 + 5;
   int y = y1 + 5;
-  textString.SetColor(c0);
-  textString.SetFont(font_arial);
-  for (auto& t : text[p]) {
-    textString.SetPosition(x, y);
-    textString.SetString(t);
-    window.Draw(textString);
+  for (TextId t : text[p]) {
+    target.Call([t, x, y, c0](smk::RenderTarget& render_target) {
+      text_cache.Draw(render_target, font_arial, tr(t), {x, y}, c0);
+    });
     y += 40;
   }
-  spaceSprite.SetPosition(x2 - 128, y2 - 135);
-  window.Draw(spaceSprite);
+  target.Draw(kSpace.At(x2 - 128, y2 - 135));
 }
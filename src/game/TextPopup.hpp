@@ -1,11 +1,11 @@
 #ifndef GAME_TEXT_POPUP_HPP
 #define GAME_TEXT_POPUP_HPP
 
-#include <smk/Sprite.hpp>
-#include <smk/Text.hpp>
 #include <string>
 #include <vector>
+#include "game/DrawList.hpp"
 #include "game/Forme.hpp"
+#include "game/Lang.hpp"
 
 namespace smk {
 class Window;
@@ -14,14 +14,17 @@ class Window;
 class TextPopup {
  public:
   TextPopup(int type);
-  bool Step(smk::Window& window);
-  void Draw(smk::Window& window);
+  // |next|: the player asked for the next page. Returns true after the last.
+  bool Step(bool next);
+  void Draw(DrawList& target);
+  // The page shown, and for how many ticks.
+  int page() const { return p; }
+  int page_time() const { return time; }
   Rectangle geometry;
+  int sensor = -1;
 
  private:
-  std::vector<std::vector<std::wstring>> text;
-  smk::Text textString;
-  smk::Sprite spaceSprite;
+  std::vector<std::vector<TextId>> text;
 
   int p = 0;
   int time = 0;
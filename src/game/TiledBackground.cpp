@@ -0,0 +1,48 @@
+#include "game/TiledBackground.hpp"
+#include <smk/OpenGL.hpp>
+#include <smk/VertexArray.hpp>
+#include <vector>
+
+TiledBackground::TiledBackground(const smk::Texture& texture)
+    : texture_(&texture) {}
+
+void TiledBackground::Draw(smk::RenderTarget& target,
+                           glm::vec2 origin,
+                           glm::vec2 size) {
+  target.Draw(Quad(origin, size));
+}
+
+void TiledBackground::Draw(DrawList& target,
+                           glm::vec2 origin,
+                           glm::vec2 size) {
+  target.Draw(Quad(origin, size));
+}
+
+const smk::Transformable& TiledBackground::Quad(glm::vec2 origin,
+                                                glm::vec2 size) {
+  // The quad only depends on the size. It is rebuilt when it changes, and
+  // moved otherwise.
+  if (size != size_) {
+    size_ = size;
+
+    // Textures are loaded clamped to the edges.
+    texture_->Bind();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+    glm::vec2 uv = size / glm::vec2(texture_->width(), texture_->height());
+    std::vector<smk::Vertex2D> vertices = {
+        {{0.f, 0.f}, {0.f, 0.f}},
+        {{size.x, 0.f}, {uv.x, 0.f}},
+        {{size.x, size.y}, {uv.x, uv.y}},
+        {{0.f, 0.f}, {0.f, 0.f}},
+        {{size.x, size.y}, {uv.x, uv.y}},
+        {{0.f, size.y}, {0.f, uv.y}},
+    };
+    transformable_.SetVertexArray(smk::VertexArray(vertices));
+    transformable_.SetTexture(*texture_);
+  }
+
+  transformable_.SetPosition(origin.x, origin.y);
+  return transformable_;
+}
@@ -0,0 +1,28 @@
+#ifndef GAME_TILED_BACKGROUND_HPP
+#define GAME_TILED_BACKGROUND_HPP
+
+#include <smk/RenderTarget.hpp>
+#include <smk/Texture.hpp>
+#include <smk/Transformable.hpp>
+#include "game/DrawList.hpp"
+
+// A texture repeated over a rectangle. The copies are drawn as a single quad
+// whose texture coordinates go past 1 and wrap with GL_REPEAT.
+class TiledBackground {
+ public:
+  explicit TiledBackground(const smk::Texture& texture);
+
+  // Cover |size| starting from |origin|, where the top-left corner of a copy
+  // of the texture lies.
+  void Draw(smk::RenderTarget& target, glm::vec2 origin, glm::vec2 size);
+  void Draw(DrawList& target, glm::vec2 origin, glm::vec2 size);
+
+ private:
+  const smk::Transformable& Quad(glm::vec2 origin, glm::vec2 size);
+
+  const smk::Texture* texture_;
+  glm::vec2 size_ = {0.f, 0.f};
+  smk::Transformable transformable_;
+};
+
+#endif /* GAME_TILED_BACKGROUND_HPP */
@@ -0,0 +1,203 @@
+#include "solver/Solver.hpp"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include "game/JobSystem.hpp"
+
+namespace {
+
+// clang-format off
+const Input::T kActions[] = {
+  Input::None,
+  Input::Left,
+  Input::Right,
+  Input::Up,
+  Input::T(Input::Left | Input::Up),
+  Input::T(Input::Right | Input::Up),
+  Input::Space,  // Select the next hero.
+  Input::Next,   // Close the text popups.
+};
+// clang-format on
+const int kActionCount = sizeof(kActions) / sizeof(kActions[0]);
+
+// The search tree. The inputs of a state are found by walking up to the root.
+struct Node {
+  int parent;
+  Input::T input;
+  int ticks;
+};
+
+struct Candidate {
+  std::unique_ptr<Level> level;
+  int ticks = 0;
+  float distance = 0.f;
+  uint64_t key = 0;
+  uint64_t area = 0;
+};
+
+struct BeamEntry {
+  std::unique_ptr<Level> level;
+  int node;
+  float distance;
+  uint64_t key;
+  uint64_t area;
+};
+
+std::vector<Input::T> Inputs(const std::vector<Node>& nodes, int node) {
+  std::vector<Input::T> inputs;
+  for (; nodes[node].parent != -1; node = nodes[node].parent)
+    inputs.insert(inputs.end(), nodes[node].ticks, nodes[node].input);
+  std::reverse(inputs.begin(), inputs.end());
+  return inputs;
+}
+
+}  // namespace
+
+SolverResult Solve(const std::string& filename,
+                   const SolverOptions& options,
+                   JobSystem* jobs) {
+  auto start = std::chrono::steady_clock::now();
+  SolverResult result;
+
+  std::vector<Node> nodes = {{-1, Input::None, 0}};
+  std::vector<BeamEntry> beam(1);
+  beam[0].level = std::make_unique<Level>(options.seed);
+  beam[0].level->LoadFromFile(filename);
+  beam[0].node = 0;
+  beam[0].key = beam[0].level->PositionKey(options.cell);
+
+  std::unordered_set<uint64_t> visited = {beam[0].key};
+
+  for (int tick = 0; tick < options.max_ticks && !beam.empty();
+       tick += options.action_ticks) {
+    // Simulate every action from every state of the beam.
+    std::vector<Candidate> candidates(beam.size() * kActionCount);
+    std::vector<std::function<void()>> tasks;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      tasks.push_back([&, i] {
+        Candidate& candidate = candidates[i];
+        const Level& from = *beam[i / kActionCount].level;
+        Input::T input = kActions[i % kActionCount];
+        candidate.level = std::make_unique<Level>(from);
+        Level& level = *candidate.level;
+        while (candidate.ticks < options.action_ticks && !level.isWin &&
+               !level.isLose) {
+          level.Step(input);
+          candidate.ticks++;
+        }
+        candidate.distance = level.DistanceToFinish();
+        candidate.key = level.PositionKey(options.cell);
+        candidate.area = level.PositionKey(options.cell * 8);
+      });
+    }
+    if (jobs) {
+      jobs->Run(tasks);
+    } else {
+      for (auto& task : tasks)
+        task();
+    }
+    result.explored += candidates.size();
+
+    // Merge in a fixed order, whatever the thread the candidates ran on.
+    std::vector<BeamEntry> next;
+    std::unordered_set<uint64_t> layer;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      Candidate& candidate = candidates[i];
+      if (candidate.level->isLose)
+        continue;
+
+      int node = nodes.size();
+      nodes.push_back({beam[i / kActionCount].node,
+                       kActions[i % kActionCount], candidate.ticks});
+
+      if (candidate.level->isWin) {
+        result.solved = true;
+        result.inputs = Inputs(nodes, node);
+        break;
+      }
+
+      if (visited.count(candidate.key) || !layer.insert(candidate.key).second)
+        continue;
+
+      next.push_back({std::move(candidate.level), node, candidate.distance,
+                      candidate.key, candidate.area});
+    }
+
+    std::stable_sort(next.begin(), next.end(),
+                     [](const BeamEntry& a, const BeamEntry& b) {
+                       return a.distance < b.distance;
+                     });
+    // Keep the closest states, but only a few per area, so that the beam
+    // doesn't fill up with a single dead end.
+    if ((int)next.size() > options.beam_width) {
+      std::unordered_map<uint64_t, int> per_area;
+      std::vector<BeamEntry> kept, crowded;
+      for (BeamEntry& entry : next) {
+        if (++per_area[entry.area] <= options.per_area)
+          kept.push_back(std::move(entry));
+        else
+          crowded.push_back(std::move(entry));
+      }
+      for (BeamEntry& entry : crowded)
+        kept.push_back(std::move(entry));
+      next = std::move(kept);
+      next.resize(options.beam_width);
+    }
+    // Only the positions kept are marked: the others may be reached again
+    // later, when the closest ones turn out to be dead ends.
+    for (const BeamEntry& entry : next)
+      visited.insert(entry.key);
+    beam = std::move(next);
+
+    if (result.solved)
+      break;
+  }
+
+  result.visited = visited.size();
+  result.seconds = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  return result;
+}
+
+bool Replay(const std::string& filename,
+            const std::vector<Input::T>& inputs,
+            int seed) {
+  Level level(seed);
+  level.LoadFromFile(filename);
+  for (Input::T input : inputs) {
+    if (level.isWin || level.isLose)
+      break;
+    level.Step(input);
+  }
+  return level.isWin;
+}
+
+std::string FormatInputs(const std::vector<Input::T>& inputs) {
+  auto name = [](Input::T input) {
+    std::string name;
+    // clang-format off
+    if (input & Input::Right) name += 'R';
+    if (input & Input::Left)  name += 'L';
+    if (input & Input::Up)    name += 'U';
+    if (input & Input::Space) name += 'S';
+    if (input & Input::Next)  name += 'N';
+    // clang-format on
+    return name.empty() ? std::string("-") : name;
+  };
+
+  std::string out;
+  for (size_t i = 0; i < inputs.size();) {
+    size_t j = i;
+    while (j < inputs.size() && inputs[j] == inputs[i])
+      ++j;
+    if (!out.empty())
+      out += ' ';
+    out += name(inputs[i]) + std::to_string(j - i);
+    i = j;
+  }
+  return out;
+}
@@ -0,0 +1,58 @@
+#ifndef SOLVER_SOLVER_HPP
+#define SOLVER_SOLVER_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "game/Level.hpp"
+
+class JobSystem;
+
+struct SolverOptions {
+  // States kept after each action.
+  int beam_width = 128;
+  // States of the beam sharing an area 8 cells wide, before the others.
+  int per_area = 8;
+  // An action is an input held for this many ticks.
+  int action_ticks = 6;
+  // Give up after this many ticks. 5 minutes.
+  int max_ticks = 9000;
+  // Two states whose heroes and blocks are in the same cells are considered
+  // the same. See Level::PositionKey().
+  float cell = 8.f;
+  int seed = 1;
+};
+
+struct SolverResult {
+  bool solved = false;
+  // One per tick, from the start of the level to the win.
+  std::vector<Input::T> inputs;
+  // Number of actions simulated.
+  long explored = 0;
+  // Number of distinct positions reached.
+  long visited = 0;
+  double seconds = 0.0;
+};
+
+// Beam search over the inputs of a level. From every state of the beam, each
+// action is tried on a copy of the Level. The new positions closest to the
+// finish block form the next beam, a few per area first. Positions already
+// kept in a beam are not explored again.
+//
+// The solution found uses the fewest actions among the explored ones. The
+// result doesn't depend on the number of threads of |jobs|. Needs no window:
+// the copies are stepped on the threads of |jobs|, and Step makes no GL call.
+SolverResult Solve(const std::string& level,
+                   const SolverOptions& options,
+                   JobSystem* jobs = nullptr);
+
+// Play |inputs| from the start of |level|. Returns whether it wins.
+bool Replay(const std::string& level,
+            const std::vector<Input::T>& inputs,
+            int seed);
+
+// Run-length encoded inputs, like "R12 RU6 -30", where R=Right, L=Left, U=Up,
+// S=Space, N=Next and "-" is no input.
+std::string FormatInputs(const std::vector<Input::T>& inputs);
+
+#endif /* SOLVER_SOLVER_HPP */
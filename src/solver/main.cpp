@@ -0,0 +1,77 @@
+// Check that the levels can be won, and find short solutions.
+//
+// Usage: inthecube_solver [-j threads] [-w beam width] [-a ticks per action]
+//                         [-t max ticks] [-c cell size] [level files]
+//
+// Without level files, every level of resources/lvl/LevelList is searched.
+// Exits with a failure if a level is not solved.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "game/JobSystem.hpp"
+#include "game/LevelListLoader.hpp"
+#include "solver/Solver.hpp"
+
+int main(int argc, char** argv) {
+  int threads = std::thread::hardware_concurrency();
+  SolverOptions options;
+  std::vector<std::string> levels;
+
+  for (int i = 1; i < argc; ++i) {
+    if (i + 1 < argc && !strcmp(argv[i], "-j"))
+      threads = atoi(argv[++i]);
+    else if (i + 1 < argc && !strcmp(argv[i], "-w"))
+      options.beam_width = atoi(argv[++i]);
+    else if (i + 1 < argc && !strcmp(argv[i], "-a"))
+      options.action_ticks = atoi(argv[++i]);
+    else if (i + 1 < argc && !strcmp(argv[i], "-t"))
+      options.max_ticks = atoi(argv[++i]);
+    else if (i + 1 < argc && !strcmp(argv[i], "-c"))
+      options.cell = atof(argv[++i]);
+    else
+      levels.push_back(argv[i]);
+  }
+
+  if (levels.empty()) {
+    levels = LevelListLoader();
+    // The first entry is the intro, not a level.
+    if (!levels.empty())
+      levels.erase(levels.begin());
+  }
+
+  std::unique_ptr<JobSystem> jobs;
+  if (threads > 1)
+    jobs = std::make_unique<JobSystem>(threads);
+
+  int unsolved = 0;
+  for (const std::string& level : levels) {
+    SolverResult result = Solve(level, options, jobs.get());
+    if (!result.solved) {
+      unsolved++;
+      printf("%s: not solved, %ld states explored, %ld positions, %.2fs\n",
+             level.c_str(), result.explored, result.visited, result.seconds);
+      fflush(stdout);
+      continue;
+    }
+
+    // The simulation is deterministic: the solution must replay.
+    bool replayed = Replay(level, result.inputs, options.seed);
+    if (!replayed)
+      unsolved++;
+    printf("%s: solved in %zu ticks, %ld states explored, %ld positions, "
+           "%.2fs%s\n  %s\n",
+           level.c_str(), result.inputs.size(), result.explored,
+           result.visited, result.seconds,
+           replayed ? "" : ", but the solution doesn't replay",
+           FormatInputs(result.inputs).c_str());
+    fflush(stdout);
+  }
+
+  printf("%zu levels, %d not solved\n", levels.size(), unsolved);
+  return unsolved ? EXIT_FAILURE : EXIT_SUCCESS;
+}
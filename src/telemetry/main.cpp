@@ -0,0 +1,201 @@
+// Aggregate the telemetry logs of many players.
+//
+// Usage: inthecube_telemetry [-c cell size] [-o directory] <log files>
+//
+// Print, per level, how often it was started, restarted and won, the time to
+// complete it, the specials triggered and the deaths by cause. The deaths are
+// also counted per cell of the level, and drawn as a heatmap. With -o, the
+// heatmaps are also written there as PGM images, one per level.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+#include "game/LevelListLoader.hpp"
+#include "game/TelemetryEvent.hpp"
+
+namespace {
+
+const char* kCauses[] = {
+    "unknown", "laser", "spike", "creeper", "electricity", "arrow", "special",
+};
+
+struct LevelReport {
+  int starts = 0;
+  int restarts = 0;
+  int specials = 0;
+  std::vector<int> wins;  // Ticks to complete.
+  int deaths[std::size(kCauses)] = {};
+  std::map<std::pair<int, int>, int> heatmap;  // Deaths per cell.
+};
+
+// Returns false when |filename| isn't a telemetry log. A record cut by a
+// crash is ignored.
+bool ReadLog(const std::string& filename,
+             int cell,
+             std::map<uint32_t, LevelReport>& reports) {
+  std::ifstream file(filename, std::ios::binary);
+  char magic[sizeof(kTelemetryMagic)];
+  if (!file.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, kTelemetryMagic, sizeof(magic))) {
+    return false;
+  }
+
+  TelemetryEvent event;
+  while (file.read(reinterpret_cast<char*>(&event), sizeof(event))) {
+    LevelReport& report = reports[event.level];
+    switch (event.type) {
+      case TelemetryType::Start:
+        report.starts++;
+        break;
+      case TelemetryType::Restart:
+        report.restarts++;
+        break;
+      case TelemetryType::Win:
+        report.wins.push_back(event.tick);
+        break;
+      case TelemetryType::Special:
+        report.specials++;
+        break;
+      case TelemetryType::Death: {
+        size_t cause = size_t(event.cause);
+        report.deaths[cause < std::size(kCauses) ? cause : 0]++;
+        int x = int(std::floor(event.x / cell));
+        int y = int(std::floor(event.y / cell));
+        report.heatmap[{x, y}]++;
+      } break;
+    }
+  }
+  return true;
+}
+
+struct Bounds {
+  int left, top, right, bottom;
+  int max;
+};
+
+Bounds HeatmapBounds(const LevelReport& report) {
+  Bounds bounds = {0, 0, -1, -1, 0};
+  bool first = true;
+  for (auto& [position, count] : report.heatmap) {
+    auto [x, y] = position;
+    if (first) {
+      bounds = {x, y, x, y, count};
+      first = false;
+    }
+    bounds.left = std::min(bounds.left, x);
+    bounds.top = std::min(bounds.top, y);
+    bounds.right = std::max(bounds.right, x);
+    bounds.bottom = std::max(bounds.bottom, y);
+    bounds.max = std::max(bounds.max, count);
+  }
+  return bounds;
+}
+
+void PrintHeatmap(const LevelReport& report, int cell) {
+  static const char kShades[] = " .:-=+*#%@";
+  const int shades = sizeof(kShades) - 1;
+  Bounds bounds = HeatmapBounds(report);
+  if (bounds.max == 0)
+    return;
+  printf("  heatmap from (%d, %d), %dpx per character, max %d:\n",
+         bounds.left * cell, bounds.top * cell, cell, bounds.max);
+  for (int y = bounds.top; y <= bounds.bottom; ++y) {
+    printf("  |");
+    for (int x = bounds.left; x <= bounds.right; ++x) {
+      auto it = report.heatmap.find({x, y});
+      int count = it == report.heatmap.end() ? 0 : it->second;
+      // Rounded up: any death is visible.
+      int shade = (count * (shades - 1) + bounds.max - 1) / bounds.max;
+      putchar(kShades[shade]);
+    }
+    printf("|\n");
+  }
+}
+
+bool WriteHeatmap(const LevelReport& report, const std::string& filename) {
+  Bounds bounds = HeatmapBounds(report);
+  if (bounds.max == 0)
+    return true;
+  int width = bounds.right - bounds.left + 1;
+  int height = bounds.bottom - bounds.top + 1;
+  std::ofstream file(filename, std::ios::binary);
+  file << "P5\n" << width << " " << height << "\n255\n";
+  for (int y = bounds.top; y <= bounds.bottom; ++y) {
+    for (int x = bounds.left; x <= bounds.right; ++x) {
+      auto it = report.heatmap.find({x, y});
+      int count = it == report.heatmap.end() ? 0 : it->second;
+      file.put(char(count * 255 / bounds.max));
+    }
+  }
+  return bool(file);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  int cell = 32;
+  std::string output;
+  std::vector<std::string> logs;
+
+  for (int i = 1; i < argc; ++i) {
+    if (i + 1 < argc && !strcmp(argv[i], "-c"))
+      cell = std::max(1, atoi(argv[++i]));
+    else if (i + 1 < argc && !strcmp(argv[i], "-o"))
+      output = argv[++i];
+    else
+      logs.push_back(argv[i]);
+  }
+
+  if (logs.empty()) {
+    fprintf(stderr, "Usage: %s [-c cell size] [-o directory] <log files>\n",
+            argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  std::map<uint32_t, LevelReport> reports;
+  for (const std::string& log : logs) {
+    if (!ReadLog(log, cell, reports))
+      fprintf(stderr, "%s: not a telemetry log\n", log.c_str());
+  }
+
+  // The logs only have the ids of the levels.
+  std::map<uint32_t, std::string> names;
+  for (const std::string& level : LevelListLoader()) {
+    std::string name = level.substr(level.find_last_of("/\\") + 1);
+    names[TelemetryLevelId(name)] = name;
+  }
+
+  for (auto& [id, report] : reports) {
+    char hex[16];
+    snprintf(hex, sizeof(hex), "%08x", id);
+    std::string name = names.count(id) ? names[id] : hex;
+
+    printf("%s: %d starts, %d restarts, %zu wins, %d specials\n",
+           name.c_str(), report.starts, report.restarts, report.wins.size(),
+           report.specials);
+    if (!report.wins.empty()) {
+      std::sort(report.wins.begin(), report.wins.end());
+      printf("  ticks to win: best %d, median %d\n", report.wins.front(),
+             report.wins[report.wins.size() / 2]);
+    }
+    printf("  deaths:");
+    for (size_t cause = 0; cause < std::size(kCauses); ++cause) {
+      if (report.deaths[cause])
+        printf(" %s=%d", kCauses[cause], report.deaths[cause]);
+    }
+    printf("\n");
+    PrintHeatmap(report, cell);
+
+    if (!output.empty() &&
+        !WriteHeatmap(report, output + "/" + name + ".pgm")) {
+      fprintf(stderr, "Can't write the heatmap of %s\n", name.c_str());
+    }
+  }
+  return EXIT_SUCCESS;
+}